@@ -10,8 +10,12 @@
 
 #include "Variable.h"
 #include "common_types.h"
-#include <Rcpp.h>
+#include "QueryCache.h"
+#include "Error.h"
+#include <algorithm>
+#include <memory>
 #include <queue>
+#include <sstream>
 
 class CategoricalVariable;
 
@@ -30,6 +34,7 @@ class CategoricalVariable : public Variable {
     std::queue<update_t> updates;
     individual_index_t shrink_index;
     std::vector<std::string> extend_values;
+    mutable std::unique_ptr<QueryCache<std::vector<std::string>>> cache;
 
 public:
     CategoricalVariable(
@@ -40,6 +45,11 @@ public:
 
     virtual individual_index_t get_index_of(const std::vector<std::string>) const;
     virtual individual_index_t get_index_of(const std::string) const;
+    virtual const individual_index_t& get_index_ref(const std::string&) const;
+
+    void enable_cache();
+    bool is_cache_enabled() const;
+    const individual_index_t& get_index_of_cached(std::vector<std::string>) const;
 
     virtual size_t get_size_of(const std::vector<std::string>) const;
     virtual size_t get_size_of(const std::string) const;
@@ -50,8 +60,13 @@ public:
     virtual void queue_shrink(const individual_index_t&);
     virtual const std::vector<std::string>& get_categories() const;
     virtual void resize() override;
+    virtual void resize(const ResizePlan&) override;
+    virtual const individual_index_t& get_shrink_index() const override;
+    virtual void tombstone(const individual_index_t&) override;
     virtual size_t size() const override;
+    virtual memory_usage_t memory_usage() const override;
     virtual void update() override;
+    virtual std::vector<task_t> update_tasks(const size_t chunks) override;
 };
 
 
@@ -77,7 +92,7 @@ inline individual_index_t CategoricalVariable::get_index_of(
         if (indices.find(category) == indices.end()) {
             std::stringstream message;
             message << "unknown category: " << category;
-            Rcpp::stop(message.str());
+            raise_error(message.str());
         }
         result |= indices.at(category);
     }
@@ -91,11 +106,52 @@ inline individual_index_t CategoricalVariable::get_index_of(
     if (indices.find(category) == indices.end()) {
         std::stringstream message;
         message << "unknown category: " << category;
-        Rcpp::stop(message.str()); 
+        raise_error(message.str()); 
     }
     return individual_index_t(indices.at(category));
 }
 
+//' @title return a reference to the bitset of individuals in some category
+//' @description unlike get_index_of this does not copy the bitset. The
+//' reference is valid until the variable is next updated or resized.
+inline const individual_index_t& CategoricalVariable::get_index_ref(
+        const std::string& category
+) const {
+    const auto it = indices.find(category);
+    if (it == indices.end()) {
+        std::stringstream message;
+        message << "unknown category: " << category;
+        raise_error(message.str());
+    }
+    return it->second;
+}
+
+//' @title memoise the results of queries until the variable next changes
+inline void CategoricalVariable::enable_cache() {
+    ensure_cache(cache);
+}
+
+inline bool CategoricalVariable::is_cache_enabled() const {
+    return static_cast<bool>(cache);
+}
+
+//' @title return a shared bitset of individuals in a set of categories
+//' @description a single category is returned directly, the union of several
+//' is computed once per version of the variable. The reference is valid until
+//' the variable next changes. Calling this enables the cache.
+inline const individual_index_t& CategoricalVariable::get_index_of_cached(
+    std::vector<std::string> categories
+) const {
+    std::sort(categories.begin(), categories.end());
+    categories.erase(std::unique(categories.begin(), categories.end()), categories.end());
+    if (categories.size() == 1) {
+        return get_index_ref(categories.front());
+    }
+    return ensure_cache(cache).get_index(get_version(), categories, [&]() {
+        return get_index_of(categories);
+    });
+}
+
 //' @title return number of individuals whose value is in a set of categories
 inline size_t CategoricalVariable::get_size_of(
         const std::vector<std::string> categories        
@@ -105,7 +161,7 @@ inline size_t CategoricalVariable::get_size_of(
         if (indices.find(category) == indices.end()) {
             std::stringstream message;
             message << "unknown category: " << category;
-            Rcpp::stop(message.str());
+            raise_error(message.str());
         } else {
             result += indices.at(category).size();
         }            
@@ -121,7 +177,7 @@ inline size_t CategoricalVariable::get_size_of(
     if (indices.find(category) == indices.end()) {
         std::stringstream message;
         message << "unknown category: " << category;
-        Rcpp::stop(message.str());
+        raise_error(message.str());
     } else {
         result += indices.at(category).size();
     }
@@ -133,31 +189,69 @@ inline void CategoricalVariable::queue_update(
         const std::string category,
         const individual_index_t& index
 ) {
+    if (defer_update([=]() { queue_update(category, index); })) {
+        return;
+    }
     updates.push({ category, index });
 }
 
 //' @title apply all queued state updates in FIFO order
 inline void CategoricalVariable::update() {
+    if (updates.size() > 0) {
+        ++version;
+    }
     while(updates.size() > 0) {
         auto& next = updates.front();
-        auto inverse_update = !next.second;
         for (auto& entry : indices) {
             if (entry.first == next.first) {
                 // destination state
                 entry.second |= next.second;
             } else {
                 // other state
-                entry.second &= inverse_update;
+                entry.second.subtract(next.second);
             }
         }
         updates.pop();
     }
 }
 
+//' @title split the queued updates into one task per category
+//' @description each task applies every update in FIFO order to the bitset of
+//' its own category, so the categories can be updated in parallel
+inline std::vector<task_t> CategoricalVariable::update_tasks(const size_t /* chunks */) {
+    auto tasks = std::vector<task_t>();
+    if (updates.size() == 0) {
+        return tasks;
+    }
+    ++version;
+    auto queued = std::make_shared<std::vector<update_t>>();
+    while(updates.size() > 0) {
+        queued->push_back(std::move(updates.front()));
+        updates.pop();
+    }
+    for (auto& entry : indices) {
+        auto& category = entry.first;
+        auto& index = entry.second;
+        tasks.push_back([queued, &category, &index]() {
+            for (const auto& next : *queued) {
+                if (next.first == category) {
+                    index |= next.second;
+                } else {
+                    index.subtract(next.second);
+                }
+            }
+        });
+    }
+    return tasks;
+}
+
 //' @title queue new values to add to the variable
 inline void CategoricalVariable::queue_extend(
     const std::vector<std::string>& new_values
 ) {
+    if (defer_update([=]() { queue_extend(new_values); })) {
+        return;
+    }
     extend_values.insert(
         extend_values.cend(),
         new_values.cbegin(),
@@ -169,8 +263,11 @@ inline void CategoricalVariable::queue_extend(
 inline void CategoricalVariable::queue_shrink(
     const individual_index_t& index
 ) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     if (index.max_size() != size()) {
-        Rcpp::stop("Invalid bitset size for variable shrink");
+        raise_error("Invalid bitset size for variable shrink");
     }
     shrink_index |= index;
 }
@@ -179,27 +276,32 @@ inline void CategoricalVariable::queue_shrink(
 inline void CategoricalVariable::queue_shrink(
     const std::vector<size_t>& index
 ) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     for (const auto& x : index) {
         if (x >= size()) {
-            Rcpp::stop("Invalid vector index for variable shrink");
+            raise_error("Invalid vector index for variable shrink");
         }
     }
     shrink_index.insert(index.cbegin(), index.cend());
 }
 
 inline void CategoricalVariable::resize() {
+    if (!coordinated) {
+        resize(ResizePlan(shrink_index));
+    }
+}
+
+//' @title remove the individuals in a plan and apply queued extensions
+inline void CategoricalVariable::resize(const ResizePlan& plan) {
     auto size_changed = false;
 
     // Apply shrink updates
-    if (shrink_index.size() > 0) {
-        auto index = std::vector<size_t>(
-            shrink_index.cbegin(),
-            shrink_index.cend()
-        );
+    if (!plan.empty()) {
         for (auto& entry : indices) {
-            entry.second.shrink(index);
+            plan.shrink(entry.second);
         }
-        shrink_index.clear();
         size_changed = true;
     }
 
@@ -217,14 +319,49 @@ inline void CategoricalVariable::resize() {
     }
 
     if (size_changed) {
+        ++version;
         shrink_index = individual_index_t(size());
     }
 }
 
+inline const individual_index_t& CategoricalVariable::get_shrink_index() const {
+    return shrink_index;
+}
+
+//' @title remove individuals who have died from every category
+//' @description they are in no category until they are updated again, such
+//' as when their slot is reused by a birth
+inline void CategoricalVariable::tombstone(const individual_index_t& index) {
+    if (index.max_size() != size()) {
+        raise_error("Invalid bitset size for variable tombstone");
+    }
+    auto removed = false;
+    for (auto& entry : indices) {
+        const auto before = entry.second.size();
+        entry.second.subtract(index);
+        removed = removed || entry.second.size() != before;
+    }
+    if (removed) {
+        ++version;
+    }
+}
+
 inline size_t CategoricalVariable::size() const {
     return indices.begin()->second.max_size();
 }
 
+//' @title the bytes held by the category bitsets, queued updates and resizes
+inline memory_usage_t CategoricalVariable::memory_usage() const {
+    auto usage = memory_usage_t();
+    usage.storage = heap_bytes(categories) + heap_bytes(indices);
+    if (cache) {
+        usage.storage += cache->memory_usage();
+    }
+    usage.updates = heap_bytes(updates);
+    usage.resizes = shrink_index.memory_usage() + heap_bytes(extend_values);
+    return usage;
+}
+
 inline const std::vector<std::string>& CategoricalVariable::get_categories() const {
     return categories;
 }
@@ -0,0 +1,498 @@
+/*
+ * CompactVariable.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_COMPACT_VARIABLE_H_
+#define INST_INCLUDE_COMPACT_VARIABLE_H_
+
+#include "IntegerVariable.h"
+#include "DoubleVariable.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+template<class Base, class S>
+class CompactVariable;
+
+//' @title check that a value can be stored in a narrower type
+//' @description integer storage must hold the value exactly; floating point
+//' storage must hold its magnitude (non-finite values are always representable)
+template<class S, class A>
+inline bool fits_storage(const A value, std::true_type) {
+    return !(value < static_cast<A>(std::numeric_limits<S>::lowest())) &&
+        !(static_cast<A>(std::numeric_limits<S>::max()) < value);
+}
+
+template<class S, class A>
+inline bool fits_storage(const A value, std::false_type) {
+    return !std::isfinite(value) ||
+        !(static_cast<A>(std::numeric_limits<S>::max()) < std::abs(value));
+}
+
+template<class S, class A>
+inline bool fits_storage(const A value) {
+    return fits_storage<S>(value, std::is_integral<S>());
+}
+
+//' @title a numeric variable stored in a narrower type
+//' @description This class stores the values of an IntegerVariable or a
+//' DoubleVariable (the Base) in a narrower type S, such as int8_t or float, to
+//' reduce memory use and the cost of scanning the values. Values are range
+//' checked when they are queued and widened to the Base value type whenever
+//' they are returned, so it can be used wherever its Base is expected. Scans
+//' read the narrowed values a word at a time through get_word_values, so no
+//' widened copy of the whole variable is kept.
+//' It contains the following data members:
+//'     * updates: a planned queue of narrowed values and indices to update
+//'     * shrink_index: a bitset of individuals to remove on resize
+//'     * extend_values: narrowed values to add on resize
+//'     * storage: a vector of narrowed values
+template<class Base, class S>
+class CompactVariable : public Base {
+
+protected:
+    using A = typename Base::value_type;
+    VectorUpdateQueue<S> updates;
+    individual_index_t shrink_index;
+    std::vector<S> extend_values;
+    std::vector<S> storage;
+
+    static std::vector<S> narrow(const std::vector<A>&);
+
+public:
+    CompactVariable(const std::vector<A>& values);
+    virtual ~CompactVariable() = default;
+
+    virtual std::vector<A> get_values() const override;
+    virtual std::vector<A> get_values(const individual_index_t& index) const override;
+    virtual std::vector<A> get_values(const std::vector<size_t>& index) const override;
+    virtual const A* get_word_values(const size_t w, A* buffer) const override;
+
+    virtual individual_index_t get_index_of_range(const A a, const A b) const override;
+    virtual size_t get_size_of_range(const A a, const A b) const override;
+
+    virtual numeric_summary_t get_summary() const override;
+    virtual numeric_summary_t get_summary(const individual_index_t& index) const override;
+    virtual std::vector<size_t> get_histogram(const std::vector<double>& breaks) const override;
+    virtual std::vector<size_t> get_histogram(const std::vector<double>& breaks, const individual_index_t& index) const override;
+    virtual std::vector<double> get_quantiles(const std::vector<double>& probs) const override;
+    virtual std::vector<double> get_quantiles(const std::vector<double>& probs, const individual_index_t& index) const override;
+
+    virtual void queue_update(std::vector<A> values, std::vector<size_t> index) override;
+    virtual void queue_update(std::vector<A> values, const individual_index_t& index) override;
+    virtual void queue_extend(const std::vector<A>&) override;
+    virtual void queue_shrink(const std::vector<size_t>&) override;
+    virtual void queue_shrink(const individual_index_t&) override;
+    virtual void resize() override;
+    virtual void resize(const ResizePlan&) override;
+    virtual const individual_index_t& get_shrink_index() const override;
+    virtual size_t size() const override;
+    virtual memory_usage_t memory_usage() const override;
+
+    virtual void update() override;
+    virtual std::vector<task_t> update_tasks(const size_t chunks) override;
+};
+
+template<class Base, class S>
+inline CompactVariable<Base, S>::CompactVariable(const std::vector<A>& values)
+    : Base(std::vector<A>()),
+      shrink_index(individual_index_t(values.size())),
+      storage(narrow(values))
+{}
+
+//' @title convert values to the storage type, checking they fit
+template<class Base, class S>
+inline std::vector<S> CompactVariable<Base, S>::narrow(const std::vector<A>& values) {
+    auto result = std::vector<S>(values.size());
+    for (auto i = 0u; i < values.size(); ++i) {
+        if (!fits_storage<S>(values[i])) {
+            std::stringstream message;
+            message << "value out of range for variable storage: " << values[i];
+            raise_error(message.str());
+        }
+        result[i] = static_cast<S>(values[i]);
+    }
+    return result;
+}
+
+//' @title get all values, widened into a new vector
+template<class Base, class S>
+inline std::vector<typename Base::value_type> CompactVariable<Base, S>::get_values() const {
+    return std::vector<A>(storage.cbegin(), storage.cend());
+}
+
+//' @title widen the values of the individuals covered by one word of a bitset
+template<class Base, class S>
+inline const typename Base::value_type* CompactVariable<Base, S>::get_word_values(
+    const size_t w,
+    A* buffer
+) const {
+    const auto start = w * 64;
+    const auto length = std::min(storage.size() - start, size_t(64));
+    const auto x = storage.data() + start;
+    for (auto k = 0u; k < length; ++k) {
+        buffer[k] = x[k];
+    }
+    return buffer;
+}
+
+//' @title get values at index given by a bitset
+template<class Base, class S>
+inline std::vector<typename Base::value_type> CompactVariable<Base, S>::get_values(
+    const individual_index_t& index
+) const {
+    if (size() != index.max_size()) {
+        raise_error("incompatible size bitset used to get values from NumericVariable");
+    }
+    auto result = std::vector<A>();
+    result.reserve(index.size());
+    for (auto i : index) {
+        result.push_back(storage[i]);
+    }
+    return result;
+}
+
+//' @title get values at index given by a vector
+template<class Base, class S>
+inline std::vector<typename Base::value_type> CompactVariable<Base, S>::get_values(
+    const std::vector<size_t>& index
+) const {
+    auto result = std::vector<A>(index.size());
+    for (auto i = 0u; i < index.size(); ++i) {
+        if (index[i] >= size()) {
+            std::stringstream message;
+            message << "index for NumericVariable out of range, supplied index: ";
+            message << index[i] << ", size of variable: " << size();
+            raise_error(message.str());
+        }
+        result[i] = storage[index[i]];
+    }
+    return result;
+}
+
+//' @title return bitset giving index of individuals whose value is in some range [a,b]
+template<class Base, class S>
+inline individual_index_t CompactVariable<Base, S>::get_index_of_range(
+    const A a, const A b
+) const {
+    auto result = individual_index_t(size());
+    for (auto i = 0u; i < storage.size(); ++i) {
+        const A v = storage[i];
+        if (!(v < a) && !(b < v)) {
+            result.insert(i);
+        }
+    }
+    return result;
+}
+
+//' @title return number of individuals whose value is in some range [a,b]
+template<class Base, class S>
+inline size_t CompactVariable<Base, S>::get_size_of_range(
+    const A a, const A b
+) const {
+    size_t result = std::count_if(storage.begin(), storage.end(), [&](const S s) -> bool {
+        const A v = s;
+        return !(v < a) && !(b < v);
+    });
+    return result;
+}
+
+//' @title summarise all values
+template<class Base, class S>
+inline numeric_summary_t CompactVariable<Base, S>::get_summary() const {
+    return summarise_values(storage, nullptr);
+}
+
+//' @title summarise values at index given by a bitset
+template<class Base, class S>
+inline numeric_summary_t CompactVariable<Base, S>::get_summary(
+    const individual_index_t& index
+) const {
+    return summarise_values(storage, &index);
+}
+
+//' @title count all values in bins given by breaks
+template<class Base, class S>
+inline std::vector<size_t> CompactVariable<Base, S>::get_histogram(
+    const std::vector<double>& breaks
+) const {
+    return histogram_values(storage, breaks, nullptr);
+}
+
+//' @title count values at index given by a bitset in bins given by breaks
+template<class Base, class S>
+inline std::vector<size_t> CompactVariable<Base, S>::get_histogram(
+    const std::vector<double>& breaks,
+    const individual_index_t& index
+) const {
+    return histogram_values(storage, breaks, &index);
+}
+
+//' @title quantiles of all values
+template<class Base, class S>
+inline std::vector<double> CompactVariable<Base, S>::get_quantiles(
+    const std::vector<double>& probs
+) const {
+    return quantile_values(storage, probs, nullptr);
+}
+
+//' @title quantiles of values at index given by a bitset
+template<class Base, class S>
+inline std::vector<double> CompactVariable<Base, S>::get_quantiles(
+    const std::vector<double>& probs,
+    const individual_index_t& index
+) const {
+    return quantile_values(storage, probs, &index);
+}
+
+//' @title queue a state update for some subset of individuals
+template<class Base, class S>
+inline void CompactVariable<Base, S>::queue_update(
+    std::vector<A> values,
+    std::vector<size_t> index
+) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
+    if (values.empty()) {
+        return;
+    }
+    if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+        raise_error("Mismatch between value and index length");
+    }
+
+    for (auto i : index) {
+        if (i >= size()) {
+            raise_error("Index out of bounds");
+        }
+    }
+    updates.push(narrow(values), std::move(index), size());
+}
+
+//' @title queue a state update for individuals given by a bitset
+template<class Base, class S>
+inline void CompactVariable<Base, S>::queue_update(
+    std::vector<A> values,
+    const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("incompatible size bitset used to queue update for NumericVariable");
+    }
+    if (values.empty() || index.empty()) {
+        return;
+    }
+    if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+        raise_error("Mismatch between value and index length");
+    }
+    updates.push(narrow(values), index);
+}
+
+//' @title apply all queued state updates in FIFO order
+template<class Base, class S>
+inline void CompactVariable<Base, S>::update() {
+    if (updates.size() > 0) {
+        ++this->version;
+    }
+    vector_update(updates, storage);
+}
+
+//' @title split the queued updates into tasks over ranges of individuals
+template<class Base, class S>
+inline std::vector<task_t> CompactVariable<Base, S>::update_tasks(const size_t chunks) {
+    if (updates.size() > 0) {
+        ++this->version;
+    }
+    return updates.apply_tasks(storage, chunks);
+}
+
+//' @title queue new values to add to the variable
+template<class Base, class S>
+inline void CompactVariable<Base, S>::queue_extend(
+    const std::vector<A>& new_values
+) {
+    if (defer_update([=]() { queue_extend(new_values); })) {
+        return;
+    }
+    const auto narrowed = narrow(new_values);
+    extend_values.insert(
+        extend_values.cend(),
+        narrowed.cbegin(),
+        narrowed.cend()
+    );
+}
+
+//' @title queue values to be erased from the variable
+template<class Base, class S>
+inline void CompactVariable<Base, S>::queue_shrink(
+    const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("Invalid bitset size for variable shrink");
+    }
+    shrink_index |= index;
+}
+
+//' @title queue values to be erased from the variable
+template<class Base, class S>
+inline void CompactVariable<Base, S>::queue_shrink(
+    const std::vector<size_t>& index
+) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
+    for (const auto& x : index) {
+        if (x >= size()) {
+            raise_error("Invalid vector index for variable shrink");
+        }
+    }
+    shrink_index.insert(index.cbegin(), index.cend());
+}
+
+template<class Base, class S>
+inline void CompactVariable<Base, S>::resize() {
+    if (!this->coordinated) {
+        resize(ResizePlan(shrink_index));
+    }
+}
+
+template<class Base, class S>
+inline void CompactVariable<Base, S>::resize(const ResizePlan& plan) {
+    if (!plan.empty() || extend_values.size() > 0) {
+        ++this->version;
+    }
+    resize_vector(storage, plan, shrink_index, extend_values);
+}
+
+template<class Base, class S>
+inline const individual_index_t& CompactVariable<Base, S>::get_shrink_index() const {
+    return shrink_index;
+}
+
+template<class Base, class S>
+inline size_t CompactVariable<Base, S>::size() const {
+    return storage.size();
+}
+
+//' @title the bytes held by the narrowed values, queued updates and resizes
+template<class Base, class S>
+inline memory_usage_t CompactVariable<Base, S>::memory_usage() const {
+    auto usage = Base::memory_usage();
+    usage.storage += heap_bytes(storage);
+    usage.updates += updates.memory_usage();
+    usage.resizes += shrink_index.memory_usage() + heap_bytes(extend_values);
+    return usage;
+}
+
+//' @title an integer variable stored in a narrower integer type
+//' @description adds the set queries of IntegerVariable to CompactVariable.
+//' Values in a query set which cannot be stored can never match, so they are
+//' dropped before the scan.
+template<class S>
+struct CompactIntegerVariable : public CompactVariable<IntegerVariable, S> {
+    CompactIntegerVariable(const std::vector<int>& values);
+    virtual ~CompactIntegerVariable() = default;
+
+    virtual individual_index_t get_index_of_set(const std::vector<int>&) const override;
+    virtual individual_index_t get_index_of_set(const int) const override;
+
+    virtual size_t get_size_of_set(const std::vector<int>&) const override;
+    virtual size_t get_size_of_set(const int) const override;
+
+private:
+    std::vector<S> narrow_set(const std::vector<int>&) const;
+};
+
+template<class S>
+inline CompactIntegerVariable<S>::CompactIntegerVariable(const std::vector<int>& values)
+    : CompactVariable<IntegerVariable, S>(values) {}
+
+template<class S>
+inline std::vector<S> CompactIntegerVariable<S>::narrow_set(
+    const std::vector<int>& values_set
+) const {
+    auto result = std::vector<S>();
+    result.reserve(values_set.size());
+    for (const auto v : values_set) {
+        if (fits_storage<S>(v)) {
+            result.push_back(static_cast<S>(v));
+        }
+    }
+    return result;
+}
+
+//' @title return bitset giving index of individuals whose value is in a finite set
+template<class S>
+inline individual_index_t CompactIntegerVariable<S>::get_index_of_set(
+    const std::vector<int>& values_set
+) const {
+    const auto& storage = this->storage;
+    const auto set = narrow_set(values_set);
+    auto result = individual_index_t(storage.size());
+    for (auto i = 0u; i < storage.size(); ++i) {
+        if (std::find(set.begin(), set.end(), storage[i]) != set.end()) {
+            result.insert(i);
+        }
+    }
+    return result;
+}
+
+//' @title return bitset giving index of individuals whose value is equal to a specific scalar
+template<class S>
+inline individual_index_t CompactIntegerVariable<S>::get_index_of_set(
+    const int value
+) const {
+    const auto& storage = this->storage;
+    auto result = individual_index_t(storage.size());
+    if (!fits_storage<S>(value)) {
+        return result;
+    }
+    const auto s = static_cast<S>(value);
+    for (auto i = 0u; i < storage.size(); ++i) {
+        if (storage[i] == s) {
+            result.insert(i);
+        }
+    }
+    return result;
+}
+
+//' @title return number of individuals whose value is in a finite set
+template<class S>
+inline size_t CompactIntegerVariable<S>::get_size_of_set(
+    const std::vector<int>& values_set
+) const {
+    const auto& storage = this->storage;
+    const auto set = narrow_set(values_set);
+    size_t result = std::count_if(storage.begin(), storage.end(), [&](const S v) -> bool {
+        return std::find(set.begin(), set.end(), v) != set.end();
+    });
+    return result;
+}
+
+//' @title return number of individuals whose value is equal to a specific scalar
+template<class S>
+inline size_t CompactIntegerVariable<S>::get_size_of_set(
+    const int value
+) const {
+    if (!fits_storage<S>(value)) {
+        return 0;
+    }
+    const auto& storage = this->storage;
+    size_t result = std::count(storage.begin(), storage.end(), static_cast<S>(value));
+    return result;
+}
+
+template<class S>
+using CompactDoubleVariable = CompactVariable<DoubleVariable, S>;
+
+#endif /* INST_INCLUDE_COMPACT_VARIABLE_H_ */
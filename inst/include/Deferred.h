@@ -0,0 +1,50 @@
+/*
+ * Deferred.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_DEFERRED_H_
+#define INST_INCLUDE_DEFERRED_H_
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+using deferred_t = std::vector<std::function<void ()>>;
+
+//' @title the buffer of the process running on this thread, if any
+//' @description while processes run in parallel, each one is given its own
+//' buffer, and the methods which queue changes to variables and events record
+//' themselves in it instead of changing shared state. The buffers are replayed
+//' on the main thread in process order once every process has finished, so
+//' the queues end up exactly as if the processes had run one after another.
+inline deferred_t*& deferred_updates() {
+    static thread_local deferred_t* buffer = nullptr;
+    return buffer;
+}
+
+//' @title record a queued change if this thread is running a parallel process
+//' @return true if the change was deferred, in which case the caller should
+//' return without applying it
+template<class F>
+inline bool defer_update(F&& f) {
+    auto buffer = deferred_updates();
+    if (buffer == nullptr) {
+        return false;
+    }
+    buffer->emplace_back(std::forward<F>(f));
+    return true;
+}
+
+//' @title replay deferred changes in the order that they were made
+inline void replay_deferred(std::vector<deferred_t>& buffers) {
+    for (auto& buffer : buffers) {
+        for (const auto& f : buffer) {
+            f();
+        }
+        buffer.clear();
+    }
+}
+
+#endif /* INST_INCLUDE_DEFERRED_H_ */
@@ -0,0 +1,87 @@
+/*
+ * Ensemble.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_ENSEMBLE_H_
+#define INST_INCLUDE_ENSEMBLE_H_
+
+#include "Simulation.h"
+#include "Random.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+class Ensemble;
+
+//' @title independent replicates of a simulation run on a thread pool
+//' @description Each replicate is a Simulation with its own variables, events
+//' and processes, which the caller builds with add_replicate. The replicates
+//' are run as one batch on a thread pool, one task per replicate, and every
+//' process of a replicate draws random numbers from the replicate's own
+//' stream, so the results do not depend on the number of threads.
+//' Replicates may share inputs which they only read, such as a mixing
+//' matrix, but must not share anything which they change, and must not call
+//' R. They are not checked for user interrupts, which is only safe on R's
+//' thread.
+//' It contains the following data members:
+//'     * replicates: the simulation of each replicate
+//'     * streams: the random number stream of each replicate
+//'     * seed: the seed from which the streams are derived
+class Ensemble {
+    std::vector<std::unique_ptr<Simulation>> replicates;
+    std::vector<rng_t> streams;
+    uint64_t seed;
+
+public:
+    Ensemble(const uint64_t seed = 0);
+    virtual ~Ensemble() = default;
+
+    virtual Simulation& add_replicate();
+    virtual size_t size() const;
+    virtual void run(const size_t start, const size_t end, const size_t threads);
+};
+
+inline Ensemble::Ensemble(const uint64_t seed) : seed(seed) {}
+
+//' @title add a replicate, returning its simulation to be built
+inline Simulation& Ensemble::add_replicate() {
+    std::seed_seq sequence{
+        static_cast<uint32_t>(seed),
+        static_cast<uint32_t>(seed >> 32),
+        static_cast<uint32_t>(replicates.size())
+    };
+    streams.emplace_back(sequence);
+    replicates.emplace_back(new Simulation());
+    return *replicates.back();
+}
+
+inline size_t Ensemble::size() const {
+    return replicates.size();
+}
+
+//' @title run every replicate from timestep start to end inclusive
+//' @param threads the number of threads to run the replicates on
+inline void Ensemble::run(const size_t start, const size_t end, const size_t threads) {
+    auto tasks = std::vector<task_t>();
+    tasks.reserve(replicates.size());
+    for (auto i = 0u; i < replicates.size(); ++i) {
+        tasks.push_back([this, i, start, end]() {
+            struct scope {
+                scope(rng_t* rng) {
+                    process_rng() = rng;
+                }
+                ~scope() {
+                    process_rng() = nullptr;
+                }
+            } guard(&streams[i]);
+            replicates[i]->run(start, end);
+        });
+    }
+    ThreadPool pool(threads);
+    pool.run(tasks);
+}
+
+#endif /* INST_INCLUDE_ENSEMBLE_H_ */
@@ -0,0 +1,27 @@
+/*
+ * Error.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_ERROR_H_
+#define INST_INCLUDE_ERROR_H_
+
+#include <stdexcept>
+#include <string>
+
+//' @title an error in the use of a bitset, variable or event
+//' @description the core headers throw this instead of calling into R, so that
+//' they can be used off R's thread and without R. Rcpp turns it into an R
+//' error with the same message when it reaches R.
+class individual_error : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+//' @title throw an individual_error with a message
+[[noreturn]] inline void raise_error(const std::string& message) {
+    throw individual_error(message);
+}
+
+#endif /* INST_INCLUDE_ERROR_H_ */
@@ -9,7 +9,9 @@
 #define INST_INCLUDE_EVENT_H_
 
 #include "common_types.h"
-#include <Rcpp.h>
+#include "ResizePlan.h"
+#include "Deferred.h"
+#include "Error.h"
 #include <set>
 #include <map>
 #include <vector>
@@ -24,7 +26,7 @@ using targeted_listener_t = std::function<void (size_t, const individual_index_t
 //' @title round a double, will error if input is negative or not finite
 inline size_t round_double(double x) {
     if (x < 0.0 || !std::isfinite(x)) {
-        Rcpp::stop("delay must be >= 0");
+        raise_error("delay must be >= 0");
     } else {
         return static_cast<size_t>(std::round(x));
     }
@@ -45,10 +47,12 @@ protected:
     size_t t = 1;
 public:
     virtual void tick();
+    virtual void resize();
     virtual size_t get_time() const;
     virtual void set_time(size_t time) = 0;
     
     virtual bool should_trigger() = 0;
+    virtual memory_usage_t memory_usage() const;
     virtual ~EventBase() = default;
 };
 
@@ -57,10 +61,18 @@ inline void EventBase::tick() {
     ++t;
 }
 
+//' @title apply queued changes to the population size, if any
+inline void EventBase::resize() {}
+
 inline size_t EventBase::get_time() const {
     return t;
 }
 
+//' @title estimate the bytes held by the event, none by default
+inline memory_usage_t EventBase::memory_usage() const {
+    return {};
+}
+
 
 //' @title a general event in the simulation
 //' @description This class provides functionality for general events which are 
@@ -75,7 +87,7 @@ class Event : public EventBase {
 public:
     virtual ~Event() = default;
 
-    virtual void process(Rcpp::XPtr<listener_t> listener);
+    virtual void process(const listener_t& listener);
     virtual bool should_trigger() override;
     virtual void tick() override;
 
@@ -85,11 +97,12 @@ public:
     virtual void set_time(size_t time) override;
     virtual std::vector<size_t> checkpoint();
     virtual void restore(std::vector<size_t> schedule);
+    virtual memory_usage_t memory_usage() const override;
 };
 
 //' @title process an event by calling a listener
-inline void Event::process(Rcpp::XPtr<listener_t> listener) {
-    (*listener)(get_time());
+inline void Event::process(const listener_t& listener) {
+    listener(get_time());
 }
 
 //' @title should first event fire on this timestep?
@@ -108,6 +121,9 @@ inline void Event::tick() {
 
 //' @title schedule a vector of events
 inline void Event::schedule(std::vector<double> delays) {
+    if (defer_update([=]() { schedule(delays); })) {
+        return;
+    }
     for (auto delay : round_delay(delays)) {
         simple_schedule.insert(get_time() + delay);
     }
@@ -115,6 +131,9 @@ inline void Event::schedule(std::vector<double> delays) {
 
 //' @title clear all scheduled events
 inline void Event::clear_schedule() {
+    if (defer_update([=]() { clear_schedule(); })) {
+        return;
+    }
     simple_schedule.clear();
 }
 
@@ -135,6 +154,13 @@ inline void Event::restore(std::vector<size_t> schedule) {
     simple_schedule.insert(schedule.begin(), schedule.end());
 }
 
+//' @title the bytes held by the schedule
+inline memory_usage_t Event::memory_usage() const {
+    auto usage = memory_usage_t();
+    usage.storage = heap_bytes(simple_schedule);
+    return usage;
+}
+
 //' @title a targeted event in the simulation
 //' @description This class provides functionality for targeted events which are 
 //' applied to a subset of individuals in the simulation. It inherits from EventBase.
@@ -143,19 +169,21 @@ inline void Event::restore(std::vector<size_t> schedule) {
 //'     * extensions: a queue of extension operations
 //'     * shrink_index: an index of individuals to remove
 //'     * size: size of population
+//'     * coordinated: whether the event is resized by a ResizeCoordinator
 class TargetedEvent : public EventBase {
 
     size_t _size = 0;
     std::map<size_t, individual_index_t> targeted_schedule;
     std::queue<std::function<void ()>> extensions;
     individual_index_t shrink_index;
+    bool coordinated = false;
 
 public:
     TargetedEvent(size_t);
     virtual ~TargetedEvent() = default;
 
     virtual bool should_trigger() override;
-    virtual void process(Rcpp::XPtr<targeted_listener_t> listener);
+    virtual void process(const targeted_listener_t& listener);
 
     virtual individual_index_t& current_target();
     virtual void tick() override;
@@ -175,7 +203,10 @@ public:
     virtual void queue_extend(size_t);
     virtual void queue_extend(const std::vector<double>&);
     virtual size_t size() const;
-    virtual void resize();
+    virtual void resize() override;
+    virtual void resize(const ResizePlan&);
+    virtual const individual_index_t& get_shrink_index() const;
+    virtual void set_coordinated();
 
     virtual void clear_schedule(const individual_index_t&);
     virtual individual_index_t get_scheduled() const;
@@ -183,6 +214,7 @@ public:
     virtual std::vector<std::pair<size_t, individual_index_t>> checkpoint() const;
     virtual void set_time(size_t time) override;
     virtual void restore(std::vector<std::pair<size_t, individual_index_t>> schedule);
+    virtual memory_usage_t memory_usage() const override;
 };
 
 inline TargetedEvent::TargetedEvent(size_t size)
@@ -197,8 +229,8 @@ inline bool TargetedEvent::should_trigger() {
 }
 
 //' @title process an event by calling a listener
-inline void TargetedEvent::process(Rcpp::XPtr<targeted_listener_t> listener) {
-    (*listener)(get_time(), current_target());
+inline void TargetedEvent::process(const targeted_listener_t& listener) {
+    listener(get_time(), current_target());
 }
 
 //' @title get bitset of individuals scheduled for the next event
@@ -221,6 +253,9 @@ inline void TargetedEvent::schedule(
     const individual_index_t& target_bitset,
     const std::vector<double>& delay
 ) {
+    if (defer_update([=]() { schedule(target_bitset, delay); })) {
+        return;
+    }
     
     //round the delays to find a discrete timestep to trigger each event
     auto rounded = round_delay(delay);
@@ -256,6 +291,9 @@ inline void TargetedEvent::schedule(
     const std::vector<size_t>& target_vector,
     const std::vector<double>& delay
 ) {
+    if (defer_update([=]() { schedule(target_vector, delay); })) {
+        return;
+    }
     
     //round the delays to find a discrete timestep to trigger each event
     auto rounded = round_delay(delay);
@@ -284,6 +322,9 @@ inline void TargetedEvent::schedule(
     const individual_index_t& target,
     double delay
 ) {
+    if (defer_update([=]() { schedule(target, delay); })) {
+        return;
+    }
     schedule(target, round_double(delay));
 }
 
@@ -294,6 +335,9 @@ inline void TargetedEvent::schedule(
     const individual_index_t& target,
     size_t delay
 ) {
+    if (defer_update([=]() { schedule(target, delay); })) {
+        return;
+    }
     
     auto target_timestep = get_time() + delay;
     if (targeted_schedule.find(target_timestep) == targeted_schedule.end()) {
@@ -306,6 +350,9 @@ inline void TargetedEvent::schedule(
 
 //' @title clear scheduled events for `target` individuals
 inline void TargetedEvent::clear_schedule(const individual_index_t& target) {
+    if (defer_update([=]() { clear_schedule(target); })) {
+        return;
+    }
     auto not_target = !target;
     for (auto& entry : targeted_schedule) {
         entry.second &= not_target;
@@ -322,6 +369,9 @@ inline individual_index_t TargetedEvent::get_scheduled() const {
 }
 
 inline void TargetedEvent::queue_extend(size_t n) {
+    if (defer_update([=]() { queue_extend(n); })) {
+        return;
+    }
     extensions.push([&, n=n]() {
         for (auto& entry : targeted_schedule) {
             entry.second.extend(n);
@@ -331,6 +381,9 @@ inline void TargetedEvent::queue_extend(size_t n) {
 }
 
 inline void TargetedEvent::queue_extend(const std::vector<double>& delays) {
+    if (defer_update([=]() { queue_extend(delays); })) {
+        return;
+    }
     extensions.push([&, delays=delays]() {
         for (auto& entry : targeted_schedule) {
             entry.second.extend(delays.size());
@@ -346,16 +399,22 @@ inline void TargetedEvent::queue_extend(const std::vector<double>& delays) {
 }
 
 inline void TargetedEvent::queue_shrink(const individual_index_t& index) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     if (index.max_size() != size()) {
-        Rcpp::stop("Invalid bitset size for variable shrink");
+        raise_error("Invalid bitset size for variable shrink");
     }
     shrink_index |= index;
 }
 
 inline void TargetedEvent::queue_shrink(const std::vector<size_t>& index) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     for (const auto& x : index) {
         if (x >= size()) {
-            Rcpp::stop("Invalid vector index for variable shrink");
+            raise_error("Invalid vector index for variable shrink");
         }
     }
     shrink_index.insert(index.cbegin(), index.cend());
@@ -366,17 +425,20 @@ inline size_t TargetedEvent::size() const {
 }
 
 inline void TargetedEvent::resize() {
+    if (!coordinated) {
+        resize(ResizePlan(shrink_index));
+    }
+}
+
+//' @title remove the individuals in a plan and apply queued extensions
+inline void TargetedEvent::resize(const ResizePlan& plan) {
     auto size_changed = false;
     // perform shrinks
-    if (shrink_index.size() > 0) {
-        const auto index = std::vector<size_t>(
-            shrink_index.begin(),
-            shrink_index.end()
-        );
+    if (!plan.empty()) {
         for (auto& entry : targeted_schedule) {
-            entry.second.shrink(index);
+            plan.shrink(entry.second);
         }
-        _size -= index.size();
+        _size = plan.get_new_size();
         size_changed = true;
     }
 
@@ -392,6 +454,15 @@ inline void TargetedEvent::resize() {
     }
 }
 
+inline const individual_index_t& TargetedEvent::get_shrink_index() const {
+    return shrink_index;
+}
+
+//' @title let a ResizeCoordinator resize this event
+inline void TargetedEvent::set_coordinated() {
+    coordinated = true;
+}
+
 //' @title save this event's state
 inline std::vector<std::pair<size_t, individual_index_t>>
 TargetedEvent::checkpoint() const {
@@ -412,4 +483,14 @@ inline void TargetedEvent::restore(
     targeted_schedule.insert(schedule.begin(), schedule.end());
 }
 
+//' @title the bytes held by the schedule and queued resizes
+//' @description each scheduled timestep holds a bitset the size of the
+//' population. Values captured by queued extensions are not counted.
+inline memory_usage_t TargetedEvent::memory_usage() const {
+    auto usage = memory_usage_t();
+    usage.storage = heap_bytes(targeted_schedule);
+    usage.resizes = heap_bytes(extensions) + shrink_index.memory_usage();
+    return usage;
+}
+
 #endif /* INST_INCLUDE_EVENT_H_ */
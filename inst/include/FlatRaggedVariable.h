@@ -0,0 +1,500 @@
+/*
+ * FlatRaggedVariable.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_FLAT_RAGGED_VARIABLE_H_
+#define INST_INCLUDE_FLAT_RAGGED_VARIABLE_H_
+
+#include "RaggedVariable.h"
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+template <class A>
+class FlatRaggedVariable;
+
+//' @title A ragged array variable stored in one contiguous vector
+//' @description This class stores the same values as RaggedVariable, but
+//' rather than one std::vector per individual, every individual's elements
+//' live in a single data vector, in a slot given by an offset and a capacity.
+//' An individual whose new values do not fit in their slot is given a new slot
+//' at the end of the data vector (the append region) and their old slot
+//' becomes slack. When slack makes up more than half of the data vector the
+//' data is compacted, so that slots are contiguous and in individual order.
+//' It can be used wherever a RaggedVariable is expected.
+//' It contains the following data members:
+//'     * updates: a planned queue of values and indices to update
+//'     * shrink_index: a bitset of individuals to remove on resize
+//'     * extend_values: values to add on resize
+//'     * data: the elements of every individual
+//'     * offsets: the start of each individual's slot in data
+//'     * lengths: the number of elements each individual has
+//'     * capacities: the number of elements each individual's slot can hold
+//'     * used: the total number of elements, i.e. the sum of lengths
+template <class A>
+class FlatRaggedVariable : public RaggedVariable<A> {
+
+protected:
+    using length_t = uint32_t;
+
+    VectorUpdateQueue<std::vector<A>> updates;
+    individual_index_t shrink_index;
+    std::vector<std::vector<A>> extend_values;
+
+    std::vector<A> data;
+    std::vector<size_t> offsets;
+    std::vector<length_t> lengths;
+    std::vector<length_t> capacities;
+    size_t used = 0;
+
+    void set(const size_t i, const std::vector<A>& value);
+    void append(const std::vector<A>& value);
+    std::vector<A> get(const size_t i) const;
+    void compact();
+    void maybe_compact();
+
+public:
+    FlatRaggedVariable(const std::vector<std::vector<A>>& values);
+    virtual ~FlatRaggedVariable() = default;
+
+    virtual std::vector<std::vector<A>> get_values() const override;
+    virtual std::vector<std::vector<A>> get_values(const individual_index_t& index) const override;
+    virtual std::vector<std::vector<A>> get_values(const std::vector<size_t>& index) const override;
+
+    virtual std::vector<size_t> get_length() const override;
+    virtual std::vector<size_t> get_length(const individual_index_t& index) const override;
+    virtual std::vector<size_t> get_length(const std::vector<size_t>& index) const override;
+
+    virtual individual_index_t get_index_of_contains(const A value) const override;
+    virtual void enable_inverted_index() override;
+
+    virtual void queue_update(const std::vector<std::vector<A>>& values, const std::vector<size_t>& index) override;
+    virtual void queue_update(const std::vector<std::vector<A>>& values, const individual_index_t& index) override;
+    virtual void queue_modify(std::function<void(std::vector<A>&)> modify, const individual_index_t& index) override;
+    virtual void queue_extend(const std::vector<std::vector<A>>&) override;
+    virtual void queue_shrink(const std::vector<size_t>&) override;
+    virtual void queue_shrink(const individual_index_t&) override;
+    virtual void resize() override;
+    virtual void resize(const ResizePlan&) override;
+    virtual const individual_index_t& get_shrink_index() const override;
+    virtual size_t size() const override;
+    virtual memory_usage_t memory_usage() const override;
+
+    virtual void update() override;
+};
+
+template<class A>
+inline FlatRaggedVariable<A>::FlatRaggedVariable(const std::vector<std::vector<A>>& values)
+    : RaggedVariable<A>(std::vector<std::vector<A>>()),
+      shrink_index(individual_index_t(values.size()))
+{
+    auto total = size_t(0);
+    for (const auto& value : values) {
+        total += value.size();
+    }
+    data.reserve(total);
+    offsets.reserve(values.size());
+    lengths.reserve(values.size());
+    capacities.reserve(values.size());
+    for (const auto& value : values) {
+        append(value);
+    }
+}
+
+//' @title add a new individual with a slot at the end of the data
+template<class A>
+inline void FlatRaggedVariable<A>::append(const std::vector<A>& value) {
+    if (value.size() > std::numeric_limits<length_t>::max()) {
+        raise_error("too many elements for an individual in FlatRaggedVariable");
+    }
+    offsets.push_back(data.size());
+    lengths.push_back(static_cast<length_t>(value.size()));
+    capacities.push_back(static_cast<length_t>(value.size()));
+    data.insert(data.cend(), value.cbegin(), value.cend());
+    used += value.size();
+}
+
+//' @title overwrite an individual's values
+//' @description values are written in place if they fit in the individual's
+//' slot, otherwise into a new slot in the append region
+template<class A>
+inline void FlatRaggedVariable<A>::set(const size_t i, const std::vector<A>& value) {
+    if (value.size() > std::numeric_limits<length_t>::max()) {
+        raise_error("too many elements for an individual in FlatRaggedVariable");
+    }
+    const auto length = static_cast<length_t>(value.size());
+    used = used - lengths[i] + length;
+    if (length > capacities[i]) {
+        offsets[i] = data.size();
+        capacities[i] = length;
+        data.insert(data.cend(), value.cbegin(), value.cend());
+    } else {
+        std::copy(value.cbegin(), value.cend(), data.begin() + offsets[i]);
+    }
+    lengths[i] = length;
+}
+
+//' @title copy an individual's values out of the data
+template<class A>
+inline std::vector<A> FlatRaggedVariable<A>::get(const size_t i) const {
+    const auto begin = data.cbegin() + offsets[i];
+    return std::vector<A>(begin, begin + lengths[i]);
+}
+
+//' @title rewrite the data so that each slot holds exactly its values, in
+//' individual order
+template<class A>
+inline void FlatRaggedVariable<A>::compact() {
+    auto compacted = std::vector<A>();
+    compacted.reserve(used);
+    for (auto i = 0u; i < offsets.size(); ++i) {
+        const auto begin = data.cbegin() + offsets[i];
+        offsets[i] = compacted.size();
+        compacted.insert(compacted.cend(), begin, begin + lengths[i]);
+        capacities[i] = lengths[i];
+    }
+    data = std::move(compacted);
+}
+
+//' @title compact the data when more than half of it is slack
+template<class A>
+inline void FlatRaggedVariable<A>::maybe_compact() {
+    if (data.size() - used > used) {
+        compact();
+    }
+}
+
+//' @title get all values
+template<class A>
+inline std::vector<std::vector<A>> FlatRaggedVariable<A>::get_values() const {
+    auto result = std::vector<std::vector<A>>(size());
+    for (auto i = 0u; i < size(); ++i) {
+        result[i] = get(i);
+    }
+    return result;
+}
+
+//' @title get values at index given by a bitset
+template<class A>
+inline std::vector<std::vector<A>> FlatRaggedVariable<A>::get_values(
+    const individual_index_t& index
+) const {
+    if (size() != index.max_size()) {
+        raise_error("incompatible size bitset used to get values from RaggedVariable<A>");
+    }
+    auto result = std::vector<std::vector<A>>(index.size());
+    auto result_i = 0u;
+    for (auto i : index) {
+        result[result_i] = get(i);
+        ++result_i;
+    }
+    return result;
+}
+
+//' @title get values at index given by a vector
+template<class A>
+inline std::vector<std::vector<A>> FlatRaggedVariable<A>::get_values(
+    const std::vector<size_t>& index
+) const {
+    auto result = std::vector<std::vector<A>>(index.size());
+    for (auto i = 0u; i < index.size(); ++i) {
+        if (index[i] >= size()) {
+            std::stringstream message;
+            message << "index for RaggedVariable out of range, supplied index: ";
+            message << index[i] << ", size of variable: " << size();
+            raise_error(message.str());
+        }
+        result[i] = get(index[i]);
+    }
+    return result;
+}
+
+//' @title get all lengths of each ragged array
+template<class A>
+inline std::vector<size_t> FlatRaggedVariable<A>::get_length() const {
+    return std::vector<size_t>(lengths.cbegin(), lengths.cend());
+}
+
+//' @title get all lengths of ragged array at index given by a bitset
+template<class A>
+inline std::vector<size_t> FlatRaggedVariable<A>::get_length(
+    const individual_index_t& index
+) const {
+    if (size() != index.max_size()) {
+        raise_error("incompatible size bitset used to get values from RaggedVariable");
+    }
+    auto result = std::vector<size_t>(index.size());
+    auto result_i = 0u;
+    for (auto i : index) {
+        result[result_i] = lengths[i];
+        ++result_i;
+    }
+    return result;
+}
+
+//' @title get all lengths of ragged array at index given by a vector
+template<class A>
+inline std::vector<size_t> FlatRaggedVariable<A>::get_length(
+    const std::vector<size_t>& index
+) const {
+    auto result = std::vector<size_t>(index.size());
+    for (auto i = 0u; i < index.size(); ++i) {
+        if (index[i] >= size()) {
+            std::stringstream message;
+            message << "index for RaggedVariable out of range, supplied index: " << index[i] << ", size of variable: " << size();
+            raise_error(message.str());
+        }
+        result[i] = lengths[index[i]];
+    }
+    return result;
+}
+
+//' @title return bitset giving index of individuals whose array contains a value
+template<class A>
+inline individual_index_t FlatRaggedVariable<A>::get_index_of_contains(const A value) const {
+    if (this->inverted_index) {
+        return this->inverted_index->get(value);
+    }
+    auto result = individual_index_t(size());
+    for (auto i = 0u; i < size(); ++i) {
+        const auto begin = data.cbegin() + offsets[i];
+        const auto end = begin + lengths[i];
+        if (std::find(begin, end, value) != end) {
+            result.insert(i);
+        }
+    }
+    return result;
+}
+
+//' @title build an inverted index to answer get_index_of_contains
+template<class A>
+inline void FlatRaggedVariable<A>::enable_inverted_index() {
+    if (this->inverted_index) {
+        return;
+    }
+    this->inverted_index.reset(new InvertedIndex<A>(size()));
+    for (auto i = 0u; i < size(); ++i) {
+        this->inverted_index->add(i, get(i));
+    }
+}
+
+//' @title queue a state update for some subset of individuals
+template<class A>
+inline void FlatRaggedVariable<A>::queue_update(
+    const std::vector<std::vector<A>>& values,
+    const std::vector<size_t>& index
+) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
+    if (values.empty()) {
+        return;
+    }
+    if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+        raise_error("Mismatch between value and index length");
+    }
+    if (index.empty() && values.size() > 1 && values.size() != size()) {
+        raise_error("Mismatch between value and variable length");
+    }
+
+    for (auto i : index) {
+        if (i >= size()) {
+            raise_error("Index out of bounds");
+        }
+    }
+    updates.push(values, index, size());
+}
+
+//' @title queue a state update for individuals given by a bitset
+template<class A>
+inline void FlatRaggedVariable<A>::queue_update(
+    const std::vector<std::vector<A>>& values,
+    const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("incompatible size bitset used to queue update for RaggedVariable");
+    }
+    if (values.empty() || index.empty()) {
+        return;
+    }
+    if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+        raise_error("Mismatch between value and index length");
+    }
+    updates.push(values, index);
+}
+
+//' @title queue a modification of the arrays of individuals given by a bitset
+template<class A>
+inline void FlatRaggedVariable<A>::queue_modify(
+    std::function<void(std::vector<A>&)> modify,
+    const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_modify(modify, index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("incompatible size bitset used to queue update for RaggedVariable");
+    }
+    if (index.empty()) {
+        return;
+    }
+    updates.push_modify(std::move(modify), index);
+}
+
+//' @title apply all queued state updates in FIFO order
+//' @description modifications are applied to a copy of each array, which is
+//' written back to its slot
+template<class A>
+inline void FlatRaggedVariable<A>::update() {
+    if (updates.size() > 0) {
+        ++this->version;
+    }
+    auto& index = this->inverted_index;
+    auto buffer = std::vector<A>();
+    updates.apply(
+        size(),
+        [this, &index](const size_t i, const std::vector<A>& value) {
+            if (index) {
+                index->remove(i, get(i));
+                index->add(i, value);
+            }
+            set(i, value);
+        },
+        [this, &index, &buffer](const size_t i, const std::function<void(std::vector<A>&)>& modify) {
+            const auto begin = data.cbegin() + offsets[i];
+            buffer.assign(begin, begin + lengths[i]);
+            if (index) {
+                index->remove(i, buffer);
+            }
+            modify(buffer);
+            if (index) {
+                index->add(i, buffer);
+            }
+            set(i, buffer);
+        }
+    );
+    maybe_compact();
+}
+
+//' @title queue new values to add to the variable
+template<class A>
+inline void FlatRaggedVariable<A>::queue_extend(
+    const std::vector<std::vector<A>>& new_values
+) {
+    if (defer_update([=]() { queue_extend(new_values); })) {
+        return;
+    }
+    extend_values.insert(
+        extend_values.cend(),
+        new_values.cbegin(),
+        new_values.cend()
+    );
+}
+
+//' @title queue values to be erased from the variable
+template<class A>
+inline void FlatRaggedVariable<A>::queue_shrink(
+    const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("Invalid bitset size for variable shrink");
+    }
+    shrink_index |= index;
+}
+
+//' @title queue values to be erased from the variable
+template<class A>
+inline void FlatRaggedVariable<A>::queue_shrink(
+    const std::vector<size_t>& index
+) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
+    for (const auto& x : index) {
+        if (x >= size()) {
+            raise_error("Invalid vector index for variable shrink");
+        }
+    }
+    shrink_index.insert(index.cbegin(), index.cend());
+}
+
+template<class A>
+inline void FlatRaggedVariable<A>::resize() {
+    if (!this->coordinated) {
+        resize(ResizePlan(shrink_index));
+    }
+}
+
+//' @title apply shrinking and extension
+//' @description removed individuals' slots become slack and new individuals
+//' are given slots in the append region
+template<class A>
+inline void FlatRaggedVariable<A>::resize(const ResizePlan& plan) {
+    auto size_changed = false;
+    auto& index = this->inverted_index;
+
+    if (!plan.empty()) {
+        for (auto i : plan.get_removed()) {
+            used -= lengths[i];
+        }
+        if (index) {
+            index->shrink(plan);
+        }
+        plan.shrink(offsets);
+        plan.shrink(lengths);
+        plan.shrink(capacities);
+        size_changed = true;
+    }
+
+    if (extend_values.size() > 0) {
+        if (index) {
+            index->extend(extend_values.size());
+        }
+        for (const auto& value : extend_values) {
+            if (index) {
+                index->add(size(), value);
+            }
+            append(value);
+        }
+        extend_values.clear();
+        size_changed = true;
+    }
+
+    if (size_changed) {
+        ++this->version;
+        shrink_index = individual_index_t(size());
+        maybe_compact();
+    }
+}
+
+template<class A>
+inline const individual_index_t& FlatRaggedVariable<A>::get_shrink_index() const {
+    return shrink_index;
+}
+
+template<class A>
+inline size_t FlatRaggedVariable<A>::size() const {
+    return offsets.size();
+}
+
+//' @title the bytes held by the data and slots, including slack, the
+//' inverted index, queued updates and resizes
+template<class A>
+inline memory_usage_t FlatRaggedVariable<A>::memory_usage() const {
+    auto usage = RaggedVariable<A>::memory_usage();
+    usage.storage += heap_bytes(data) + heap_bytes(offsets) +
+        (lengths.capacity() + capacities.capacity()) * sizeof(length_t);
+    usage.updates += updates.memory_usage();
+    usage.resizes += shrink_index.memory_usage() + heap_bytes(extend_values);
+    return usage;
+}
+
+#endif /* INST_INCLUDE_FLAT_RAGGED_VARIABLE_H_ */
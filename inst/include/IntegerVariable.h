@@ -30,6 +30,9 @@ struct IntegerVariable : public NumericVariable<int> {
     virtual size_t get_size_of_set(const std::vector<int>&) const;
     virtual size_t get_size_of_set(const int) const;
     virtual size_t get_size_of_range(const int, const int) const;
+
+    const individual_index_t& get_index_of_set_cached(std::vector<int>) const;
+    size_t get_size_of_set_cached(std::vector<int>) const;
 };
 
 inline IntegerVariable::IntegerVariable(const std::vector<int>& values)
@@ -114,4 +117,36 @@ inline size_t IntegerVariable::get_size_of_range(
     return result;
 }
 
+//' @title make the cache key for a set query
+//' @description sets are sorted so that equal sets share a result, and
+//' prefixed to distinguish them from range queries
+inline std::vector<int> set_cache_key(std::vector<int> values_set) {
+    std::sort(values_set.begin(), values_set.end());
+    values_set.erase(std::unique(values_set.begin(), values_set.end()), values_set.end());
+    values_set.insert(values_set.begin(), 1);
+    return values_set;
+}
+
+//' @title return a shared bitset of individuals whose value is in a finite set
+//' @description the result is computed once per version of the variable, the
+//' reference is valid until the variable next changes. Calling this enables
+//' the cache.
+inline const individual_index_t& IntegerVariable::get_index_of_set_cached(
+    std::vector<int> values_set
+) const {
+    return get_cache().get_index(get_version(), set_cache_key(values_set), [&]() {
+        return get_index_of_set(values_set);
+    });
+}
+
+//' @title return the number of individuals whose value is in a finite set,
+//' computed once per version of the variable
+inline size_t IntegerVariable::get_size_of_set_cached(
+    std::vector<int> values_set
+) const {
+    return get_cache().get_size(get_version(), set_cache_key(values_set), [&]() {
+        return get_size_of_set(values_set);
+    });
+}
+
 #endif /* INST_INCLUDE_INTEGER_VARIABLE_H_ */
@@ -0,0 +1,126 @@
+/*
+ * InvertedIndex.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_INVERTED_INDEX_H_
+#define INST_INCLUDE_INVERTED_INDEX_H_
+
+#include "common_types.h"
+#include "ResizePlan.h"
+#include <unordered_map>
+
+template <class A>
+class InvertedIndex;
+
+//' @title an index from values to the individuals whose arrays contain them
+//' @description This class maps each value stored in a ragged variable to a
+//' bitset of the individuals whose arrays contain it, so that membership
+//' queries are a lookup rather than a scan. It is kept up to date by the
+//' variable as arrays are updated, and shrunk and extended with it. Each
+//' distinct value costs a bitset the size of the population, so it is
+//' intended for values from a small set, such as household or product ids.
+//' It contains the following data members:
+//'     * index: a map from value to the individuals whose arrays contain it
+//'     * n: the size of the population
+template <class A>
+class InvertedIndex {
+    std::unordered_map<A, individual_index_t> index;
+    size_t n;
+
+public:
+    InvertedIndex(const size_t size);
+    virtual ~InvertedIndex() = default;
+
+    virtual void add(const size_t i, const std::vector<A>& values);
+    virtual void remove(const size_t i, const std::vector<A>& values);
+    virtual void remove(const individual_index_t& individuals);
+    virtual individual_index_t get(const A value) const;
+    virtual void shrink(const ResizePlan& plan);
+    virtual void extend(const size_t n);
+    virtual size_t memory_usage() const;
+};
+
+template<class A>
+inline InvertedIndex<A>::InvertedIndex(const size_t size) : n(size) {}
+
+//' @title record that individual i's array contains values
+template<class A>
+inline void InvertedIndex<A>::add(const size_t i, const std::vector<A>& values) {
+    for (const auto& value : values) {
+        auto it = index.find(value);
+        if (it == index.end()) {
+            it = index.emplace(value, individual_index_t(n)).first;
+        }
+        it->second.insert(i);
+    }
+}
+
+//' @title record that individual i's array no longer contains values
+template<class A>
+inline void InvertedIndex<A>::remove(const size_t i, const std::vector<A>& values) {
+    for (const auto& value : values) {
+        auto it = index.find(value);
+        if (it != index.end()) {
+            it->second.erase(i);
+            if (it->second.empty()) {
+                index.erase(it);
+            }
+        }
+    }
+}
+
+//' @title remove individuals from the index, whatever their arrays contain
+template<class A>
+inline void InvertedIndex<A>::remove(const individual_index_t& individuals) {
+    for (auto it = index.begin(); it != index.end();) {
+        it->second.subtract(individuals);
+        if (it->second.empty()) {
+            it = index.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+//' @title get the individuals whose arrays contain a value
+template<class A>
+inline individual_index_t InvertedIndex<A>::get(const A value) const {
+    const auto it = index.find(value);
+    if (it == index.end()) {
+        return individual_index_t(n);
+    }
+    return it->second;
+}
+
+//' @title remove individuals from the index, shifting those after them down
+template<class A>
+inline void InvertedIndex<A>::shrink(const ResizePlan& plan) {
+    for (auto it = index.begin(); it != index.end();) {
+        plan.shrink(it->second);
+        if (it->second.empty()) {
+            it = index.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    n = plan.get_new_size();
+}
+
+//' @title add space for new individuals at the end of the index
+template<class A>
+inline void InvertedIndex<A>::extend(const size_t new_individuals) {
+    for (auto& entry : index) {
+        entry.second.extend(new_individuals);
+    }
+    n += new_individuals;
+}
+
+//' @title the bytes held by the index, including a bitset for each value
+template<class A>
+inline size_t InvertedIndex<A>::memory_usage() const {
+    return heap_bytes(index);
+}
+
+#endif /* INST_INCLUDE_INVERTED_INDEX_H_ */
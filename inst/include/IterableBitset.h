@@ -8,9 +8,14 @@
 #ifndef INST_INCLUDE_ITERABLEBITSET_H_
 #define INST_INCLUDE_ITERABLEBITSET_H_
 
+#include <algorithm>
 #include <cmath>
-#include <Rcpp.h>
+#include <list>
+#include "Error.h"
 #include "utils.h"
+#include "Random.h"
+#include "Trace.h"
+#include "memory_usage.h"
 
 template<class A>
 class IterableBitset;
@@ -79,6 +84,7 @@ public:
     IterableBitset& operator&=(const IterableBitset&);
     IterableBitset& operator|=(const IterableBitset&);
     IterableBitset& operator^=(const IterableBitset&);
+    IterableBitset& subtract(const IterableBitset&);
     IterableBitset& clear();
     IterableBitset& inverse();
     iterator begin();
@@ -99,8 +105,13 @@ public:
     size_type size() const;
     size_type max_size() const;
     bool empty() const;
+    size_t n_words() const;
+    size_t memory_usage() const;
+    A word(size_t) const;
+    void set_word(size_t, A);
     void extend(size_t);
     void shrink(const std::vector<size_t>&);
+    void truncate(size_t);
     size_t next_position(size_t start, size_t n) const;
 };
 
@@ -263,6 +274,7 @@ inline IterableBitset<A>& IterableBitset<A>::clear() {
 
 template<class A>
 inline IterableBitset<A>& IterableBitset<A>::inverse() {
+  TraceScope trace("bitset_inverse", "bitset");
   for (auto i = 0u; i < bitmap.size(); ++i) {
     bitmap[i] = ~bitmap[i];
   }
@@ -282,8 +294,9 @@ inline IterableBitset<A> IterableBitset<A>::operator !() const {
 
 template<class A>
 inline IterableBitset<A>& IterableBitset<A>::operator &=(const IterableBitset<A>& other) {
+    TraceScope trace("bitset_and", "bitset");
     if (max_size() != other.max_size()) {
-        Rcpp::stop("Incompatible bitmap sizes");
+        raise_error("Incompatible bitmap sizes");
     }
     n = 0;
     for (auto i = 0u; i < bitmap.size(); ++i) {
@@ -295,8 +308,9 @@ inline IterableBitset<A>& IterableBitset<A>::operator &=(const IterableBitset<A>
 
 template<class A>
 inline IterableBitset<A>& IterableBitset<A>::operator |=(const IterableBitset<A>& other) {
+    TraceScope trace("bitset_or", "bitset");
     if (max_size() != other.max_size()) {
-        Rcpp::stop("Incompatible bitmap sizes");
+        raise_error("Incompatible bitmap sizes");
     }
     n = 0;
     for (auto i = 0u; i < bitmap.size(); ++i) {
@@ -308,8 +322,9 @@ inline IterableBitset<A>& IterableBitset<A>::operator |=(const IterableBitset<A>
 
 template<class A>
 inline IterableBitset<A>& IterableBitset<A>::operator ^=(const IterableBitset<A>& other) {
+    TraceScope trace("bitset_xor", "bitset");
     if (max_size() != other.max_size()) {
-        Rcpp::stop("Incompatible bitmap sizes");
+        raise_error("Incompatible bitmap sizes");
     }
     n = 0;
     for (auto i = 0u; i < bitmap.size(); ++i) {
@@ -319,6 +334,22 @@ inline IterableBitset<A>& IterableBitset<A>::operator ^=(const IterableBitset<A>
     return *this;
 }
 
+//' @title remove the members of another bitset
+//' @description the same as &= !other, without allocating the inverse
+template<class A>
+inline IterableBitset<A>& IterableBitset<A>::subtract(const IterableBitset<A>& other) {
+    TraceScope trace("bitset_subtract", "bitset");
+    if (max_size() != other.max_size()) {
+        raise_error("Incompatible bitmap sizes");
+    }
+    n = 0;
+    for (auto i = 0u; i < bitmap.size(); ++i) {
+        bitmap[i] &= ~other.bitmap[i];
+        n += popcount(bitmap[i]);
+    }
+    return *this;
+}
+
 template<class A>
 inline typename IterableBitset<A>::iterator IterableBitset<A>::begin() {
     return IterableBitset<A>::iterator(*this);
@@ -492,7 +523,7 @@ inline void IterableBitset<A>::insert(size_t v) {
 template<class A>
 inline void IterableBitset<A>::insert_safe(size_t v) {
     if (v >= max_n) {
-        Rcpp::stop("Insert out of range");
+        raise_error("Insert out of range");
     }
     insert(v);
 }
@@ -512,6 +543,81 @@ inline bool IterableBitset<A>::empty() const {
     return n == 0;
 }
 
+//' @title number of words in the underlying bitmap
+template<class A>
+inline size_t IterableBitset<A>::n_words() const {
+    return bitmap.size();
+}
+
+//' @title the bytes held by the underlying bitmap
+template<class A>
+inline size_t IterableBitset<A>::memory_usage() const {
+    return bitmap.capacity() * sizeof(A);
+}
+
+//' @title the heap memory held by a bitset, so that containers of bitsets can
+//' be counted
+template<class A>
+inline size_t heap_bytes(const IterableBitset<A>& b) {
+    return b.memory_usage();
+}
+
+//' @title get the i-th word of the underlying bitmap
+//' @description bit j of word i is set if i * sizeof(A) * 8 + j is in the set
+template<class A>
+inline A IterableBitset<A>::word(size_t i) const {
+    return bitmap[i];
+}
+
+//' @title overwrite the i-th word of the underlying bitmap
+//' @description bits beyond max_size are ignored
+template<class A>
+inline void IterableBitset<A>::set_word(size_t i, A value) {
+    if (i == max_n / num_bits) {
+        value &= (static_cast<A>(1) << (max_n % num_bits)) - 1;
+    }
+    n = n - popcount(bitmap[i]) + popcount(value);
+    bitmap[i] = value;
+}
+
+//' @title call f(i) for each member i of a bitset, visiting it word by word
+//' @description words with no members are skipped with a single comparison
+template<class A, class F>
+inline void bitset_for_each(const IterableBitset<A>& b, F&& f) {
+    const auto word_bits = sizeof(A) * 8;
+    for (auto w = 0u; w < b.n_words(); ++w) {
+        auto word = b.word(w);
+        while (word != 0) {
+            f(w * word_bits + ctz(word));
+            word &= word - 1;
+        }
+    }
+}
+
+//' @title call f(i) for each member i of a bitset in [begin, end)
+//' @description begin must be a multiple of the word size
+template<class A, class F>
+inline void bitset_for_each(
+    const IterableBitset<A>& b,
+    const size_t begin,
+    const size_t end,
+    F&& f
+) {
+    const auto word_bits = sizeof(A) * 8;
+    const auto last = std::min((end + word_bits - 1) / word_bits, b.n_words());
+    for (auto w = begin / word_bits; w < last; ++w) {
+        auto word = b.word(w);
+        while (word != 0) {
+            const auto i = w * word_bits + ctz(word);
+            if (i >= end) {
+                break;
+            }
+            f(i);
+            word &= word - 1;
+        }
+    }
+}
+
 //' @title bitset to vector
 //' @description return a vector of unsigned ints indicating which bits are set
 template<class A>
@@ -561,13 +667,8 @@ inline void bitset_choose_internal(
     IterableBitset<A>& b,
     const size_t k
 ){
-  auto to_remove = Rcpp::sample(
-    b.size(),
-    b.size() - k,
-    false, // replacement
-    R_NilValue, // evenly distributed
-    false // one based
-  );
+  TraceScope trace("bitset_choose", "sampling");
+  auto to_remove = random_sample(b.size(), b.size() - k);
   std::sort(to_remove.begin(), to_remove.end());
   auto bitset_i = 0;
   auto bitset_it = b.cbegin();
@@ -615,7 +716,7 @@ struct fast_bernouilli {
             return SIZE_MAX;
         }
 
-        double x = R::runif(0.0, 1.0);
+        double x = random_uniform();
         double skip_count = floor(log(x) * inverse_log);
         if (skip_count < double(SIZE_MAX)) {
             return skip_count;
@@ -652,6 +753,7 @@ inline void bitset_sample_internal(
         IterableBitset<A>& b,
         const double rate
         ){
+    TraceScope trace("bitset_sample", "sampling");
     if (rate < 0.5) {
         fast_bernouilli bernouilli(rate);
         size_t i = 0;
@@ -684,9 +786,10 @@ inline void bitset_sample_multi_internal(
     InputIterator begin,
     InputIterator end
 ){  
+    TraceScope trace("bitset_sample_multi", "sampling");
     // sample elements
     size_t n = b.size();
-    const auto random = Rcpp::runif(n);
+    const auto random = random_uniforms(n);
     auto i = 0u;
     auto probs_it = begin;
     auto bitset_it = b.cbegin();
@@ -716,6 +819,25 @@ inline void IterableBitset<A>::extend(size_t n) {
     max_n += n;
 }
 
+//' @title truncate the bitset
+//' @description removes the elements at or after `size`, leaving the others
+//' in place
+template<class A>
+inline void IterableBitset<A>::truncate(size_t size) {
+    if (size >= max_n) {
+        return;
+    }
+    const auto n_blocks = size / num_bits + 1;
+    for (auto i = n_blocks; i < bitmap.size(); ++i) {
+        n -= popcount(bitmap[i]);
+    }
+    bitmap.erase(bitmap.begin() + n_blocks, bitmap.end());
+    const auto residual = (static_cast<A>(1) << (size % num_bits)) - 1;
+    n -= popcount(bitmap.back() & ~residual);
+    bitmap.back() &= residual;
+    max_n = size;
+}
+
 //' @title shrink the bitset
 //' @description removes the elements in `index` shifting subsequent elements to
 //fill their position. Assumes `index` is sorted and unique
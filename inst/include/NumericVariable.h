@@ -9,10 +9,15 @@
 #define INST_INCLUDE_NUMERIC_VARIABLE_H_
 
 #include "Variable.h"
+#include "CategoricalVariable.h"
 #include "common_types.h"
 #include "vector_variables.h"
-#include <Rcpp.h>
+#include "aggregation.h"
+#include "QueryCache.h"
+#include <memory>
+#include "Error.h"
 #include <queue>
+#include <sstream>
 
 template <class A>
 class NumericVariable;
@@ -21,39 +26,64 @@ class NumericVariable;
 //' @description This class provides functionality for variables which takes values
 //' in the real numbers. It inherits from Variable.
 //' It contains the following data members:
-//'     * updates: a priority queue of pairs of values and indices to update
+//'     * updates: a planned queue of values and indices to update (see VectorUpdateQueue)
 //'     * size: the number of elements stored (size of population)
 //'     * values: a vector of values
+//'     * cache: memoised query results, if caching is enabled
 template <class A>
 class NumericVariable : public Variable {
 
-    using update_t = std::pair<std::vector<A>, std::vector<size_t>>;
-    std::queue<update_t> updates;
+    VectorUpdateQueue<A> updates;
     individual_index_t shrink_index;
     std::vector<A> extend_values;
 
 protected:
     std::vector<A> values;
+    mutable std::unique_ptr<QueryCache<std::vector<A>>> cache;
+
+    QueryCache<std::vector<A>>& get_cache() const;
     
 public:
+    using value_type = A;
+
     NumericVariable(const std::vector<A>& values);
     virtual ~NumericVariable() = default;
 
-    virtual const std::vector<A>& get_values() const;
+    virtual std::vector<A> get_values() const;
     virtual std::vector<A> get_values(const individual_index_t& index) const;
     virtual std::vector<A> get_values(const std::vector<size_t>& index) const;
+    virtual const A* get_word_values(const size_t w, A* buffer) const;
 
     virtual individual_index_t get_index_of_range(const A a, const A b) const;
     virtual size_t get_size_of_range(const A a, const A b) const;
 
+    void enable_cache();
+    bool is_cache_enabled() const;
+    const individual_index_t& get_index_of_range_cached(const A a, const A b) const;
+    size_t get_size_of_range_cached(const A a, const A b) const;
+
+    virtual numeric_summary_t get_summary() const;
+    virtual numeric_summary_t get_summary(const individual_index_t& index) const;
+    virtual std::vector<size_t> get_histogram(const std::vector<double>& breaks) const;
+    virtual std::vector<size_t> get_histogram(const std::vector<double>& breaks, const individual_index_t& index) const;
+    virtual std::vector<double> get_quantiles(const std::vector<double>& probs) const;
+    virtual std::vector<double> get_quantiles(const std::vector<double>& probs, const individual_index_t& index) const;
+    std::vector<numeric_summary_t> get_summary_by(const CategoricalVariable& group) const;
+    std::vector<numeric_summary_t> get_summary_by(const CategoricalVariable& group, const individual_index_t& index) const;
+
     virtual void queue_update(std::vector<A> values, std::vector<size_t> index);
+    virtual void queue_update(std::vector<A> values, const individual_index_t& index);
     virtual void queue_extend(const std::vector<A>&);
     virtual void queue_shrink(const std::vector<size_t>&);
     virtual void queue_shrink(const individual_index_t&);
     virtual void resize() override;
+    virtual void resize(const ResizePlan&) override;
+    virtual const individual_index_t& get_shrink_index() const override;
     virtual size_t size() const override;
+    virtual memory_usage_t memory_usage() const override;
 
     virtual void update() override;
+    virtual std::vector<task_t> update_tasks(const size_t chunks) override;
 };
 
 template<class A>
@@ -63,15 +93,30 @@ inline NumericVariable<A>::NumericVariable(const std::vector<A>& values)
 
 //' @title get all values
 template<class A>
-inline const std::vector<A>& NumericVariable<A>::get_values() const {
+inline std::vector<A> NumericVariable<A>::get_values() const {
     return values;
 }
 
+//' @title get the values of the individuals covered by one word of a bitset
+//' @description lets scans read the values 64 at a time without copying the
+//' whole variable. The values are read in place where possible, otherwise
+//' they are written to buffer.
+//' @param w the word, covering individuals [64w, 64w + 64)
+//' @param buffer space for 64 values
+//' @return a pointer to the values of the individuals in the word
+template<class A>
+inline const A* NumericVariable<A>::get_word_values(
+    const size_t w,
+    A* /* buffer */
+) const {
+    return values.data() + w * 64;
+}
+
 //' @title get values at index given by a bitset
 template<class A>
 inline std::vector<A> NumericVariable<A>::get_values(const individual_index_t& index) const {
     if (size() != index.max_size()) {
-        Rcpp::stop("incompatible size bitset used to get values from NumericVariable");
+        raise_error("incompatible size bitset used to get values from NumericVariable");
     }
     auto result = std::vector<A>();
     result.reserve(index.size());
@@ -91,7 +136,7 @@ inline std::vector<A> NumericVariable<A>::get_values(const std::vector<size_t>&
             std::stringstream message;
             message << "index for NumericVariable out of range, supplied index: ";
             message << index[i] << ", size of variable: " << size();
-            Rcpp::stop(message.str()); 
+            raise_error(message.str()); 
         }
         result[i] = values[index[i]];
     }
@@ -129,38 +174,207 @@ inline size_t NumericVariable<A>::get_size_of_range(
     
 }
 
+//' @title memoise the results of queries until the variable next changes
+template<class A>
+inline void NumericVariable<A>::enable_cache() {
+    get_cache();
+}
+
+template<class A>
+inline bool NumericVariable<A>::is_cache_enabled() const {
+    return static_cast<bool>(cache);
+}
+
+template<class A>
+inline QueryCache<std::vector<A>>& NumericVariable<A>::get_cache() const {
+    return ensure_cache(cache);
+}
+
+//' @title return a shared bitset of individuals whose value is in some range [a,b]
+//' @description the result is computed once per version of the variable, the
+//' reference is valid until the variable next changes. Calling this enables
+//' the cache.
+template<class A>
+inline const individual_index_t& NumericVariable<A>::get_index_of_range_cached(
+    const A a, const A b
+) const {
+    return get_cache().get_index(get_version(), {A(0), a, b}, [&]() {
+        return get_index_of_range(a, b);
+    });
+}
+
+//' @title return the number of individuals whose value is in some range [a,b],
+//' computed once per version of the variable
+template<class A>
+inline size_t NumericVariable<A>::get_size_of_range_cached(
+    const A a, const A b
+) const {
+    return get_cache().get_size(get_version(), {A(0), a, b}, [&]() {
+        return get_size_of_range(a, b);
+    });
+}
+
+//' @title summarise all values
+template<class A>
+inline numeric_summary_t NumericVariable<A>::get_summary() const {
+    return summarise_values(values, nullptr);
+}
+
+//' @title summarise values at index given by a bitset
+template<class A>
+inline numeric_summary_t NumericVariable<A>::get_summary(
+    const individual_index_t& index
+) const {
+    return summarise_values(values, &index);
+}
+
+//' @title count all values in bins given by breaks
+template<class A>
+inline std::vector<size_t> NumericVariable<A>::get_histogram(
+    const std::vector<double>& breaks
+) const {
+    return histogram_values(values, breaks, nullptr);
+}
+
+//' @title count values at index given by a bitset in bins given by breaks
+template<class A>
+inline std::vector<size_t> NumericVariable<A>::get_histogram(
+    const std::vector<double>& breaks,
+    const individual_index_t& index
+) const {
+    return histogram_values(values, breaks, &index);
+}
+
+//' @title quantiles of all values
+template<class A>
+inline std::vector<double> NumericVariable<A>::get_quantiles(
+    const std::vector<double>& probs
+) const {
+    return quantile_values(values, probs, nullptr);
+}
+
+//' @title quantiles of values at index given by a bitset
+template<class A>
+inline std::vector<double> NumericVariable<A>::get_quantiles(
+    const std::vector<double>& probs,
+    const individual_index_t& index
+) const {
+    return quantile_values(values, probs, &index);
+}
+
+//' @title summarise values for each category of a CategoricalVariable
+//' @description summaries are returned in the order of group.get_categories()
+template<class A>
+inline std::vector<numeric_summary_t> NumericVariable<A>::get_summary_by(
+    const CategoricalVariable& group
+) const {
+    if (group.size() != size()) {
+        raise_error("incompatible size CategoricalVariable used to group values");
+    }
+    const auto& categories = group.get_categories();
+    auto result = std::vector<numeric_summary_t>();
+    result.reserve(categories.size());
+    for (const auto& category : categories) {
+        result.push_back(get_summary(group.get_index_ref(category)));
+    }
+    return result;
+}
+
+//' @title summarise values at index given by a bitset for each category of a
+//' CategoricalVariable
+template<class A>
+inline std::vector<numeric_summary_t> NumericVariable<A>::get_summary_by(
+    const CategoricalVariable& group,
+    const individual_index_t& index
+) const {
+    if (group.size() != size()) {
+        raise_error("incompatible size CategoricalVariable used to group values");
+    }
+    if (index.max_size() != size()) {
+        raise_error("incompatible size bitset used to aggregate values");
+    }
+    const auto& categories = group.get_categories();
+    auto result = std::vector<numeric_summary_t>();
+    result.reserve(categories.size());
+    for (const auto& category : categories) {
+        auto members = group.get_index_of(category);
+        members &= index;
+        result.push_back(get_summary(members));
+    }
+    return result;
+}
+
 //' @title queue a state update for some subset of individuals
 template<class A>
 inline void NumericVariable<A>::queue_update(
         std::vector<A> values,
         std::vector<size_t> index
 ) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
     if (values.empty()) {
         return;
     }
     if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
-        Rcpp::stop("Mismatch between value and index length");
+        raise_error("Mismatch between value and index length");
     }
     
     for (auto i : index) {
         if (i >= size()) {
-            Rcpp::stop("Index out of bounds");
+            raise_error("Index out of bounds");
         }
     }
-    updates.push({ std::move(values), std::move(index) });
+    updates.push(std::move(values), std::move(index), size());
+}
+
+//' @title queue a state update for individuals given by a bitset
+template<class A>
+inline void NumericVariable<A>::queue_update(
+        std::vector<A> values,
+        const individual_index_t& index
+) {
+    if (defer_update([=]() { queue_update(values, index); })) {
+        return;
+    }
+    if (index.max_size() != size()) {
+        raise_error("incompatible size bitset used to queue update for NumericVariable");
+    }
+    if (values.empty() || index.empty()) {
+        return;
+    }
+    if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+        raise_error("Mismatch between value and index length");
+    }
+    updates.push(std::move(values), index);
 }
 
 //' @title apply all queued state updates in FIFO order
 template<class A>
 inline void NumericVariable<A>::update() {
+    if (updates.size() > 0) {
+        ++version;
+    }
     vector_update(updates, values);
 }
 
+//' @title split the queued updates into tasks over ranges of individuals
+template<class A>
+inline std::vector<task_t> NumericVariable<A>::update_tasks(const size_t chunks) {
+    if (updates.size() > 0) {
+        ++version;
+    }
+    return updates.apply_tasks(values, chunks);
+}
+
 //' @title queue new values to add to the variable
 template<class A>
 inline void NumericVariable<A>::queue_extend(
     const std::vector<A>& new_values
 ) {
+    if (defer_update([=]() { queue_extend(new_values); })) {
+        return;
+    }
     extend_values.insert(
         extend_values.cend(),
         new_values.cbegin(),
@@ -173,8 +387,11 @@ template<class A>
 inline void NumericVariable<A>::queue_shrink(
     const individual_index_t& index
 ) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     if (index.max_size() != size()) {
-        Rcpp::stop("Invalid bitset size for variable shrink");
+        raise_error("Invalid bitset size for variable shrink");
     }
     shrink_index |= index;
 }
@@ -184,9 +401,12 @@ template<class A>
 inline void NumericVariable<A>::queue_shrink(
     const std::vector<size_t>& index
 ) {
+    if (defer_update([=]() { queue_shrink(index); })) {
+        return;
+    }
     for (const auto& x : index) {
         if (x >= size()) {
-            Rcpp::stop("Invalid vector index for variable shrink");
+            raise_error("Invalid vector index for variable shrink");
         }
     }
     shrink_index.insert(index.cbegin(), index.cend());
@@ -194,7 +414,23 @@ inline void NumericVariable<A>::queue_shrink(
 
 template<class A>
 inline void NumericVariable<A>::resize() {
-    resize_vector(values, shrink_index, extend_values);
+    if (!coordinated) {
+        resize(ResizePlan(shrink_index));
+    }
+}
+
+//' @title remove the individuals in a plan and apply queued extensions
+template<class A>
+inline void NumericVariable<A>::resize(const ResizePlan& plan) {
+    if (!plan.empty() || extend_values.size() > 0) {
+        ++version;
+    }
+    resize_vector(values, plan, shrink_index, extend_values);
+}
+
+template<class A>
+inline const individual_index_t& NumericVariable<A>::get_shrink_index() const {
+    return shrink_index;
 }
 
 template<class A>
@@ -202,4 +438,17 @@ inline size_t NumericVariable<A>::size() const {
     return values.size();
 }
 
+//' @title the bytes held by the values, queued updates and resizes
+template<class A>
+inline memory_usage_t NumericVariable<A>::memory_usage() const {
+    auto usage = memory_usage_t();
+    usage.storage = heap_bytes(values);
+    if (cache) {
+        usage.storage += cache->memory_usage();
+    }
+    usage.updates = updates.memory_usage();
+    usage.resizes = shrink_index.memory_usage() + heap_bytes(extend_values);
+    return usage;
+}
+
 #endif /* INST_INCLUDE_NUMERIC_VARIABLE_H_ */
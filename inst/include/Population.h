@@ -0,0 +1,202 @@
+/*
+ * Population.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_POPULATION_H_
+#define INST_INCLUDE_POPULATION_H_
+
+#include "common_types.h"
+#include "Error.h"
+
+class Population;
+
+//' @title a population of stable slots
+//' @description This class tracks which slots of a set of variables and
+//' events hold living individuals, so that deaths do not renumber everyone
+//' after them. A death tombstones the individual's slot: it is removed from
+//' the alive bitset and added to the free list, and the slot is handed to the
+//' next individual born. The slots are only renumbered when the fraction of
+//' free slots passes compaction_threshold, at which point compact returns the
+//' free slots so that they can be shrunk out of the variables and events.
+//' Until then, the free slots should be tombstoned in the variables after
+//' every resize (see ResizeCoordinator::tombstone), so that the dead are not
+//' counted in their categories.
+//' It contains the following data members:
+//'     * alive: the slots holding living individuals
+//'     * free: the tombstoned slots, available for reuse
+//'     * shrink_index: the individuals to tombstone on the next resize
+//'     * births: reused slots to mark alive on the next resize
+//'     * extend_size: the number of slots to add on the next resize
+//'     * compaction_threshold: the fraction of free slots which triggers
+//'     compaction
+class Population {
+    individual_index_t alive;
+    individual_index_t free;
+    individual_index_t shrink_index;
+    std::vector<size_t> births;
+    size_t extend_size = 0;
+    double compaction_threshold;
+
+public:
+    Population(const size_t size, const double compaction_threshold);
+    virtual ~Population() = default;
+
+    virtual const individual_index_t& get_alive() const;
+    virtual const individual_index_t& get_free() const;
+    virtual size_t size() const;
+    virtual size_t capacity() const;
+
+    virtual void queue_shrink(const individual_index_t&);
+    virtual void queue_shrink(const std::vector<size_t>&);
+    virtual std::vector<size_t> queue_extend(const size_t n);
+    virtual void resize();
+
+    virtual bool should_compact() const;
+    virtual individual_index_t compact();
+    virtual void restore(const individual_index_t& alive);
+    virtual memory_usage_t memory_usage() const;
+};
+
+inline Population::Population(
+    const size_t size,
+    const double compaction_threshold
+) : alive(individual_index_t(size)),
+    free(individual_index_t(size)),
+    shrink_index(individual_index_t(size)),
+    compaction_threshold(compaction_threshold) {
+    if (!(compaction_threshold >= 0 && compaction_threshold <= 1)) {
+        raise_error("compaction threshold must be in [0, 1]");
+    }
+    alive.inverse();
+}
+
+//' @title get the slots holding living individuals
+inline const individual_index_t& Population::get_alive() const {
+    return alive;
+}
+
+//' @title get the tombstoned slots
+inline const individual_index_t& Population::get_free() const {
+    return free;
+}
+
+//' @title get the number of living individuals
+inline size_t Population::size() const {
+    return alive.size();
+}
+
+//' @title get the number of slots, living or tombstoned
+inline size_t Population::capacity() const {
+    return alive.max_size();
+}
+
+//' @title queue individuals to be tombstoned
+inline void Population::queue_shrink(const individual_index_t& index) {
+    if (index.max_size() != capacity()) {
+        raise_error("Invalid bitset size for population shrink");
+    }
+    shrink_index |= index;
+}
+
+//' @title queue individuals to be tombstoned
+inline void Population::queue_shrink(const std::vector<size_t>& index) {
+    for (const auto& x : index) {
+        if (x >= capacity()) {
+            raise_error("Invalid vector index for population shrink");
+        }
+    }
+    shrink_index.insert(index.cbegin(), index.cend());
+}
+
+//' @title allocate slots for n new individuals
+//' @description free slots are reused in increasing order and are taken off
+//' the free list straight away, so later calls in the same timestep are given
+//' different slots. Once the free list is empty, new slots are allocated
+//' after the current capacity, which the variables and events must be
+//' extended to hold.
+//' @return the slots, reused slots (which are less than the capacity) first
+inline std::vector<size_t> Population::queue_extend(const size_t n) {
+    auto slots = std::vector<size_t>();
+    slots.reserve(n);
+    for (auto it = free.cbegin(); it != free.cend() && slots.size() < n; ++it) {
+        slots.push_back(*it);
+    }
+    for (const auto slot : slots) {
+        free.erase(slot);
+    }
+    births.insert(births.end(), slots.cbegin(), slots.cend());
+    while (slots.size() < n) {
+        slots.push_back(capacity() + extend_size);
+        ++extend_size;
+    }
+    return slots;
+}
+
+//' @title apply queued deaths and births
+//' @description deaths are applied first, and only to living individuals, so
+//' an individual born into a reused slot cannot die in the same timestep.
+inline void Population::resize() {
+    if (shrink_index.size() > 0) {
+        shrink_index &= alive;
+        free |= shrink_index;
+        alive &= !shrink_index;
+        shrink_index.clear();
+    }
+
+    if (extend_size > 0) {
+        const auto old_capacity = capacity();
+        alive.extend(extend_size);
+        free.extend(extend_size);
+        for (auto i = old_capacity; i < capacity(); ++i) {
+            alive.insert(i);
+        }
+        extend_size = 0;
+        shrink_index = individual_index_t(capacity());
+    }
+
+    alive.insert(births.cbegin(), births.cend());
+    births.clear();
+}
+
+//' @title should the free slots be shrunk out of the population?
+inline bool Population::should_compact() const {
+    return free.size() > 0 && free.size() >= compaction_threshold * capacity();
+}
+
+//' @title shrink the free slots out of the population
+//' @description queued births and deaths must be applied first.
+//' @return the free slots, to be shrunk out of the variables and events
+inline individual_index_t Population::compact() {
+    if (extend_size > 0 || !births.empty() || shrink_index.size() > 0) {
+        raise_error("a population must be resized before it is compacted");
+    }
+    auto removed = free;
+    alive.shrink(bitset_to_vector_internal(removed, false));
+    free = individual_index_t(capacity());
+    shrink_index = individual_index_t(capacity());
+    return removed;
+}
+
+//' @title restore the living individuals from a previous checkpoint
+inline void Population::restore(const individual_index_t& new_alive) {
+    if (new_alive.max_size() != capacity()) {
+        raise_error("Invalid bitset size for population restore");
+    }
+    alive = new_alive;
+    free = !alive;
+    shrink_index.clear();
+    births.clear();
+    extend_size = 0;
+}
+
+//' @title the bytes held by the slot bitsets and queued births and deaths
+inline memory_usage_t Population::memory_usage() const {
+    auto usage = memory_usage_t();
+    usage.storage = alive.memory_usage() + free.memory_usage();
+    usage.resizes = shrink_index.memory_usage() + heap_bytes(births);
+    return usage;
+}
+
+#endif /* INST_INCLUDE_POPULATION_H_ */
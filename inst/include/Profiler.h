@@ -0,0 +1,125 @@
+/*
+ * Profiler.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_PROFILER_H_
+#define INST_INCLUDE_PROFILER_H_
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using profile_clock_t = std::chrono::steady_clock;
+
+class Profiler;
+
+//' @title records how long each phase of a simulation takes on each timestep
+//' @description A phase is a process, a listener, or a variable's update or
+//' resize, identified by its kind and name. Phases are registered once, and
+//' each timing is then recorded against the phase's id, so recording does not
+//' look up or copy names. Recording is not thread safe, so timings of phases
+//' run in parallel are recorded on the calling thread once they finish.
+//' It contains the following data members:
+//'     * kinds: the kind of each phase
+//'     * names: the name of each phase
+//'     * ids: the id of each phase by its kind and name
+//'     * timesteps: the timestep of each timing
+//'     * phases: the phase of each timing
+//'     * seconds: the duration of each timing
+class Profiler {
+    std::vector<std::string> kinds;
+    std::vector<std::string> names;
+    std::map<std::pair<std::string, std::string>, size_t> ids;
+    std::vector<size_t> timesteps;
+    std::vector<size_t> phases;
+    std::vector<double> seconds;
+
+public:
+    virtual ~Profiler() = default;
+
+    virtual size_t add_phase(const std::string& kind, const std::string& name);
+    virtual void record(const size_t timestep, const size_t phase, const double elapsed);
+
+    template<class F>
+    void time(const size_t timestep, const size_t phase, F&& f);
+
+    virtual size_t size() const;
+    virtual const std::vector<size_t>& get_timesteps() const;
+    virtual std::vector<std::string> get_kinds() const;
+    virtual std::vector<std::string> get_names() const;
+    virtual const std::vector<double>& get_seconds() const;
+};
+
+//' @title the seconds elapsed since start
+inline double seconds_since(const profile_clock_t::time_point start) {
+    return std::chrono::duration<double>(profile_clock_t::now() - start).count();
+}
+
+//' @title get the id of a phase, registering it if it is new
+inline size_t Profiler::add_phase(const std::string& kind, const std::string& name) {
+    const auto key = std::make_pair(kind, name);
+    const auto it = ids.find(key);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    const auto id = kinds.size();
+    kinds.push_back(kind);
+    names.push_back(name);
+    ids.emplace(key, id);
+    return id;
+}
+
+inline void Profiler::record(
+    const size_t timestep,
+    const size_t phase,
+    const double elapsed
+) {
+    timesteps.push_back(timestep);
+    phases.push_back(phase);
+    seconds.push_back(elapsed);
+}
+
+//' @title call f and record how long it took
+template<class F>
+inline void Profiler::time(const size_t timestep, const size_t phase, F&& f) {
+    const auto start = profile_clock_t::now();
+    f();
+    record(timestep, phase, seconds_since(start));
+}
+
+//' @title the number of timings recorded
+inline size_t Profiler::size() const {
+    return seconds.size();
+}
+
+inline const std::vector<size_t>& Profiler::get_timesteps() const {
+    return timesteps;
+}
+
+//' @title the kind of the phase of each timing
+inline std::vector<std::string> Profiler::get_kinds() const {
+    auto result = std::vector<std::string>(phases.size());
+    for (auto i = 0u; i < phases.size(); ++i) {
+        result[i] = kinds[phases[i]];
+    }
+    return result;
+}
+
+//' @title the name of the phase of each timing
+inline std::vector<std::string> Profiler::get_names() const {
+    auto result = std::vector<std::string>(phases.size());
+    for (auto i = 0u; i < phases.size(); ++i) {
+        result[i] = names[phases[i]];
+    }
+    return result;
+}
+
+inline const std::vector<double>& Profiler::get_seconds() const {
+    return seconds;
+}
+
+#endif /* INST_INCLUDE_PROFILER_H_ */
@@ -0,0 +1,226 @@
+/*
+ * Query.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_QUERY_H_
+#define INST_INCLUDE_QUERY_H_
+
+#include "CategoricalVariable.h"
+#include "NumericVariable.h"
+#include "IntegerVariable.h"
+#include "DoubleVariable.h"
+#include "crosstab.h"
+#include "Error.h"
+#include <memory>
+
+class Query;
+
+//' @title a term of a query
+//' @description a term computes, for one word of the output bitset at a time,
+//' which of the 64 individuals covered by the word satisfy it.
+//' prepare is called once per evaluation, before any words are requested, so
+//' that terms can look up their variables' current state.
+struct query_term_t {
+    virtual ~query_term_t() = default;
+    virtual size_t size() const = 0;
+    virtual void prepare() = 0;
+    virtual uint64_t word(const size_t w) const = 0;
+};
+
+//' @title a term satisfied by individuals in some categories
+//' @description the word is the union of the words of the category bitsets
+struct categorical_term_t : public query_term_t {
+    const CategoricalVariable& variable;
+    const std::vector<std::string> categories;
+    std::vector<const individual_index_t*> indices;
+
+    categorical_term_t(
+        const CategoricalVariable& variable,
+        const std::vector<std::string>& categories
+    ) : variable(variable), categories(categories) {}
+
+    virtual size_t size() const override {
+        return variable.size();
+    }
+
+    virtual void prepare() override {
+        indices.clear();
+        for (const auto& category : categories) {
+            indices.push_back(&variable.get_index_ref(category));
+        }
+    }
+
+    virtual uint64_t word(const size_t w) const override {
+        auto result = uint64_t(0);
+        for (const auto index : indices) {
+            result |= index->word(w);
+        }
+        return result;
+    }
+};
+
+//' @title a term satisfied by individuals whose value is in some range [a,b]
+//' @description the mask for a word is built from a branch-free comparison of
+//' the 64 values it covers, which the compiler can vectorise. The values are
+//' read a word at a time, so variables with compact storage are scanned in
+//' their narrow type.
+template<class A>
+struct range_term_t : public query_term_t {
+    const NumericVariable<A>& variable;
+    const A a;
+    const A b;
+
+    range_term_t(const NumericVariable<A>& variable, const A a, const A b)
+        : variable(variable), a(a), b(b) {}
+
+    virtual size_t size() const override {
+        return variable.size();
+    }
+
+    virtual void prepare() override {}
+
+    virtual uint64_t word(const size_t w) const override {
+        const auto start = w * 64;
+        const auto length = std::min(variable.size() - start, size_t(64));
+        A buffer[64];
+        const auto x = variable.get_word_values(w, buffer);
+        auto result = uint64_t(0);
+        for (auto k = 0u; k < length; ++k) {
+            result |= static_cast<uint64_t>(!(x[k] < a) & !(b < x[k])) << k;
+        }
+        return result;
+    }
+};
+
+//' @title a term satisfied by individuals whose integer value is in a set
+//' @description values are looked up with level_codes_t, so small sets spanning
+//' a small range are tested with a table lookup
+struct set_term_t : public query_term_t {
+    const IntegerVariable& variable;
+    const level_codes_t codes;
+
+    set_term_t(const IntegerVariable& variable, const std::vector<int>& set)
+        : variable(variable), codes(set) {}
+
+    virtual size_t size() const override {
+        return variable.size();
+    }
+
+    virtual void prepare() override {}
+
+    virtual uint64_t word(const size_t w) const override {
+        const auto start = w * 64;
+        const auto length = std::min(variable.size() - start, size_t(64));
+        int buffer[64];
+        const auto x = variable.get_word_values(w, buffer);
+        auto result = uint64_t(0);
+        for (auto k = 0u; k < length; ++k) {
+            result |= static_cast<uint64_t>(codes(x[k]) != level_codes_t::npos) << k;
+        }
+        return result;
+    }
+};
+
+//' @title a conjunction of terms over several variables
+//' @description A query selects the individuals who satisfy every one of its
+//' terms. Rather than building a bitset for each term and intersecting them,
+//' the output is computed one word at a time: the terms are asked for the
+//' word in the order they were added, and the remaining terms are skipped as
+//' soon as the word is empty, so cheap, selective terms should be added
+//' first. The query holds references to its variables and can be evaluated
+//' again on later timesteps.
+//' It contains the following data members:
+//'     * terms: the terms to intersect
+class Query {
+    std::vector<std::unique_ptr<query_term_t>> terms;
+
+    individual_index_t evaluate(const individual_index_t* within);
+
+public:
+    Query() = default;
+    virtual ~Query() = default;
+
+    virtual void add_categorical(const CategoricalVariable&, const std::vector<std::string>&);
+    virtual void add_set(const IntegerVariable&, const std::vector<int>&);
+    virtual void add_range(const IntegerVariable&, const int a, const int b);
+    virtual void add_range(const DoubleVariable&, const double a, const double b);
+
+    virtual individual_index_t evaluate();
+    virtual individual_index_t evaluate(const individual_index_t& within);
+};
+
+inline void Query::add_categorical(
+    const CategoricalVariable& variable,
+    const std::vector<std::string>& categories
+) {
+    for (const auto& category : categories) {
+        variable.get_index_ref(category);
+    }
+    terms.emplace_back(new categorical_term_t(variable, categories));
+}
+
+inline void Query::add_set(
+    const IntegerVariable& variable,
+    const std::vector<int>& set
+) {
+    terms.emplace_back(new set_term_t(variable, set));
+}
+
+inline void Query::add_range(
+    const IntegerVariable& variable,
+    const int a,
+    const int b
+) {
+    terms.emplace_back(new range_term_t<int>(variable, a, b));
+}
+
+inline void Query::add_range(
+    const DoubleVariable& variable,
+    const double a,
+    const double b
+) {
+    terms.emplace_back(new range_term_t<double>(variable, a, b));
+}
+
+//' @title find the individuals who satisfy every term
+inline individual_index_t Query::evaluate() {
+    return evaluate(nullptr);
+}
+
+//' @title find the individuals in a bitset who satisfy every term
+inline individual_index_t Query::evaluate(const individual_index_t& within) {
+    return evaluate(&within);
+}
+
+inline individual_index_t Query::evaluate(const individual_index_t* within) {
+    if (terms.empty()) {
+        raise_error("a query must have at least one term");
+    }
+    const auto size = terms.front()->size();
+    for (const auto& term : terms) {
+        if (term->size() != size) {
+            raise_error("variables in a query must be the same size");
+        }
+        term->prepare();
+    }
+    if (within != nullptr && within->max_size() != size) {
+        raise_error("incompatible size bitset used to restrict a query");
+    }
+
+    auto result = individual_index_t(size);
+    const auto n_words = (size + 63) / 64;
+    for (auto w = 0u; w < n_words; ++w) {
+        auto word = within == nullptr ? ~uint64_t(0) : within->word(w);
+        for (auto it = terms.cbegin(); word != 0 && it != terms.cend(); ++it) {
+            word &= (*it)->word(w);
+        }
+        if (word != 0) {
+            result.set_word(w, word);
+        }
+    }
+    return result;
+}
+
+#endif /* INST_INCLUDE_QUERY_H_ */
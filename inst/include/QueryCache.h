@@ -0,0 +1,114 @@
+/*
+ * QueryCache.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_QUERY_CACHE_H_
+#define INST_INCLUDE_QUERY_CACHE_H_
+
+#include "common_types.h"
+#include <map>
+#include <memory>
+#include <mutex>
+
+template<class Key>
+class QueryCache;
+
+//' @title a memo of query results for one version of a variable
+//' @description Variables count their versions, moving to a new version
+//' whenever update() or resize() changes them. This class stores the results
+//' of queries keyed by their arguments, and forgets them all as soon as it is
+//' asked about a newer version, so repeated queries between updates are
+//' computed once and then shared by reference.
+//' Lookups are locked, so processes running in parallel can share a cache.
+//' Stored results are never moved, so a reference stays valid while other
+//' threads add results for the same version.
+//' It contains the following data members:
+//'     * version: the variable version the stored results are valid for
+//'     * indices: bitset results keyed by query arguments
+//'     * sizes: count results keyed by query arguments
+//'     * mutex: guards the stored results
+template<class Key>
+class QueryCache {
+    size_t version = 0;
+    std::map<Key, individual_index_t> indices;
+    std::map<Key, size_t> sizes;
+    std::recursive_mutex mutex;
+
+    void synchronise(const size_t variable_version);
+
+public:
+    template<class F>
+    const individual_index_t& get_index(const size_t variable_version, const Key& key, F&& compute);
+    template<class F>
+    size_t get_size(const size_t variable_version, const Key& key, F&& compute);
+    size_t memory_usage();
+};
+
+//' @title forget stored results if the variable has changed
+template<class Key>
+inline void QueryCache<Key>::synchronise(const size_t variable_version) {
+    if (variable_version != version) {
+        indices.clear();
+        sizes.clear();
+        version = variable_version;
+    }
+}
+
+//' @title look up a bitset result, computing it with compute() if needed
+//' @description the reference is valid until the next call for a newer version
+template<class Key>
+template<class F>
+inline const individual_index_t& QueryCache<Key>::get_index(
+    const size_t variable_version,
+    const Key& key,
+    F&& compute
+) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    synchronise(variable_version);
+    auto it = indices.find(key);
+    if (it == indices.end()) {
+        it = indices.emplace(key, compute()).first;
+    }
+    return it->second;
+}
+
+//' @title look up a count result, computing it with compute() if needed
+template<class Key>
+template<class F>
+inline size_t QueryCache<Key>::get_size(
+    const size_t variable_version,
+    const Key& key,
+    F&& compute
+) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    synchronise(variable_version);
+    auto it = sizes.find(key);
+    if (it == sizes.end()) {
+        it = sizes.emplace(key, compute()).first;
+    }
+    return it->second;
+}
+
+//' @title the bytes held by the stored results
+template<class Key>
+inline size_t QueryCache<Key>::memory_usage() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return heap_bytes(indices) + heap_bytes(sizes);
+}
+
+//' @title create a variable's cache if it does not have one yet
+//' @description variables create their cache on first use, which may be from
+//' several processes at once
+template<class Key>
+inline QueryCache<Key>& ensure_cache(std::unique_ptr<QueryCache<Key>>& cache) {
+    static std::mutex creation;
+    std::lock_guard<std::mutex> lock(creation);
+    if (!cache) {
+        cache.reset(new QueryCache<Key>());
+    }
+    return *cache;
+}
+
+#endif /* INST_INCLUDE_QUERY_CACHE_H_ */
@@ -0,0 +1,54 @@
+/*
+ * RRandom.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_R_RANDOM_H_
+#define INST_INCLUDE_R_RANDOM_H_
+
+#include "Random.h"
+#include <Rcpp.h>
+
+//' @title draws random numbers from R's random number generator
+//' @description only safe on R's thread. Processes run in parallel draw from
+//' their own streams instead.
+struct RRandomSource : public RandomSource {
+    virtual double uniform() override {
+        return R::runif(0.0, 1.0);
+    }
+
+    virtual std::vector<double> uniforms(const size_t n) override {
+        // draw straight into the result, without an intermediate R vector
+        auto result = std::vector<double>(n);
+        for (auto& u : result) {
+            u = R::runif(0.0, 1.0);
+        }
+        return result;
+    }
+
+    virtual std::vector<int> sample(const int n, const int size) override {
+        return Rcpp::as<std::vector<int>>(Rcpp::sample(
+            n,
+            size,
+            false, // replacement
+            R_NilValue, // evenly distributed
+            false // one based
+        ));
+    }
+};
+
+//' @title install R's random number generator as the random source
+inline bool install_r_random_source() {
+    static RRandomSource source;
+    random_source() = &source;
+    return true;
+}
+
+namespace {
+    // every translation unit which uses the package from R installs the source
+    // when it is loaded, before any random numbers are drawn
+    const bool r_random_source_installed = install_r_random_source();
+}
+
+#endif /* INST_INCLUDE_R_RANDOM_H_ */
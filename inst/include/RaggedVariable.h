@@ -11,8 +11,13 @@
 #include "Variable.h"
 #include "common_types.h"
 #include "vector_variables.h"
-#include <Rcpp.h>
+#include "InvertedIndex.h"
+#include "Error.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <queue>
+#include <sstream>
 
 // forward declaration
 template <class A>
@@ -23,19 +28,21 @@ class RaggedVariable;
 //' be stored for each individual. The array storing each individual's container
 //' is a std::vector. It inherits from Variable.
 //' It contains the following data members:
-//'     * updates: a priority queue of pairs of values and indices to update
+//'     * updates: a planned queue of values and indices to update (see VectorUpdateQueue)
 //'     * size: the number of elements stored (size of population)
 //'     * values: a vector of vectors of values
+//'     * inverted_index: an optional index from each value to the individuals
+//'     whose arrays contain it, maintained through updates and resizes
 template <class A>
 class RaggedVariable : public Variable {
   
-  using update_t = std::pair<std::vector<std::vector<A>>, std::vector<size_t>>;
-  std::queue<update_t> updates;
+  VectorUpdateQueue<std::vector<A>> updates;
   individual_index_t shrink_index;
   std::vector<std::vector<A>> extend_values;
   
 protected:
   std::vector<std::vector<A>> values;
+  std::unique_ptr<InvertedIndex<A>> inverted_index;
 
 public:
   RaggedVariable(const std::vector<std::vector<A>>& values);
@@ -49,12 +56,25 @@ public:
   virtual std::vector<size_t> get_length(const individual_index_t& index) const;
   virtual std::vector<size_t> get_length(const std::vector<size_t>& index) const;
   
+  virtual individual_index_t get_index_of_contains(const A value) const;
+  virtual void enable_inverted_index();
+  
   virtual void queue_update(const std::vector<std::vector<A>>& values, const std::vector<size_t>& index);
+  virtual void queue_update(const std::vector<std::vector<A>>& values, const individual_index_t& index);
+  virtual void queue_modify(std::function<void(std::vector<A>&)> modify, const individual_index_t& index);
+  virtual void queue_push_back(const A value, const individual_index_t& index);
+  virtual void queue_remove(const A value, const individual_index_t& index);
+  virtual void queue_remove_range(const A a, const A b, const individual_index_t& index);
+  virtual void queue_truncate(const size_t length, const individual_index_t& index);
   virtual void queue_extend(const std::vector<std::vector<A>>&);
   virtual void queue_shrink(const std::vector<size_t>&);
   virtual void queue_shrink(const individual_index_t&);
   virtual void resize() override;
+  virtual void resize(const ResizePlan&) override;
+  virtual const individual_index_t& get_shrink_index() const override;
+  virtual void tombstone(const individual_index_t&) override;
   virtual size_t size() const override;
+  virtual memory_usage_t memory_usage() const override;
   
   virtual void update() override;
 };
@@ -74,7 +94,7 @@ inline std::vector<std::vector<A>> RaggedVariable<A>::get_values() const {
 template<class A>
 inline std::vector<std::vector<A>> RaggedVariable<A>::get_values(const individual_index_t& index) const {
   if (size() != index.max_size()) {
-    Rcpp::stop("incompatible size bitset used to get values from RaggedVariable<A>");
+    raise_error("incompatible size bitset used to get values from RaggedVariable<A>");
   }
   auto result = std::vector<std::vector<A>>(index.size());
   auto result_i = 0u;
@@ -95,7 +115,7 @@ inline std::vector<std::vector<A>> RaggedVariable<A>::get_values(const std::vect
       std::stringstream message;
       message << "index for RaggedVariable out of range, supplied index: ";
       message << index[i] << ", size of variable: " << size();
-      Rcpp::stop(message.str()); 
+      raise_error(message.str()); 
     }
     result[i] = values[index[i]];
   }
@@ -116,7 +136,7 @@ inline std::vector<size_t> RaggedVariable<T>::get_length() const {
 template <typename T>
 inline std::vector<size_t> RaggedVariable<T>::get_length(const individual_index_t& index) const {
   if (size() != index.max_size()) {
-    Rcpp::stop("incompatible size bitset used to get values from RaggedVariable");
+    raise_error("incompatible size bitset used to get values from RaggedVariable");
   }
   std::vector<size_t> lengths(index.size());
   auto result_i = 0u;
@@ -135,38 +155,180 @@ inline std::vector<size_t> RaggedVariable<T>::get_length(const std::vector<size_
     if (index[i] >= size()) {
       std::stringstream message;
       message << "index for RaggedVariable out of range, supplied index: " << index[i] << ", size of variable: " << size();
-      Rcpp::stop(message.str());
+      raise_error(message.str());
     }
     lengths[i] = values[index[i]].size();
   }
   return lengths;
 }
 
+//' @title return bitset giving index of individuals whose array contains a value
+//' @description uses the inverted index if it is enabled, otherwise scans
+//' every array
+template<class A>
+inline individual_index_t RaggedVariable<A>::get_index_of_contains(const A value) const {
+  if (inverted_index) {
+    return inverted_index->get(value);
+  }
+  auto result = individual_index_t(size());
+  for (auto i = 0u; i < size(); ++i) {
+    if (std::find(values[i].cbegin(), values[i].cend(), value) != values[i].cend()) {
+      result.insert(i);
+    }
+  }
+  return result;
+}
+
+//' @title build an inverted index to answer get_index_of_contains
+//' @description once enabled, the index is kept up to date by update() and
+//' resize()
+template<class A>
+inline void RaggedVariable<A>::enable_inverted_index() {
+  if (inverted_index) {
+    return;
+  }
+  inverted_index.reset(new InvertedIndex<A>(size()));
+  for (auto i = 0u; i < size(); ++i) {
+    inverted_index->add(i, values[i]);
+  }
+}
+
 //' @title queue a state update for some subset of individuals
 template<class A>
 inline void RaggedVariable<A>::queue_update(
     const std::vector<std::vector<A>>& values,
     const std::vector<size_t>& index
 ) {
+  if (defer_update([=]() { queue_update(values, index); })) {
+    return;
+  }
   if (values.empty()) {
     return;
   }
   if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
-    Rcpp::stop("Mismatch between value and index length");
+    raise_error("Mismatch between value and index length");
   }
   
   for (auto i : index) {
     if (i >= size()) {
-      Rcpp::stop("Index out of bounds");
+      raise_error("Index out of bounds");
     }
   }
-  updates.push({ values, index });
+  updates.push(values, index, size());
+}
+
+//' @title queue a state update for individuals given by a bitset
+template<class A>
+inline void RaggedVariable<A>::queue_update(
+    const std::vector<std::vector<A>>& values,
+    const individual_index_t& index
+) {
+  if (defer_update([=]() { queue_update(values, index); })) {
+    return;
+  }
+  if (index.max_size() != size()) {
+    raise_error("incompatible size bitset used to queue update for RaggedVariable");
+  }
+  if (values.empty() || index.empty()) {
+    return;
+  }
+  if (values.size() > 1 && values.size() < size() && values.size() != index.size()) {
+    raise_error("Mismatch between value and index length");
+  }
+  updates.push(values, index);
+}
+
+//' @title queue a modification of the arrays of individuals given by a bitset
+//' @description modifications are applied in update(), in FIFO order with
+//' the other queued updates
+template<class A>
+inline void RaggedVariable<A>::queue_modify(
+    std::function<void(std::vector<A>&)> modify,
+    const individual_index_t& index
+) {
+  if (defer_update([=]() { queue_modify(modify, index); })) {
+    return;
+  }
+  if (index.max_size() != size()) {
+    raise_error("incompatible size bitset used to queue update for RaggedVariable");
+  }
+  if (index.empty()) {
+    return;
+  }
+  updates.push_modify(std::move(modify), index);
+}
+
+//' @title queue a value to be appended to the arrays of individuals given by a bitset
+template<class A>
+inline void RaggedVariable<A>::queue_push_back(
+    const A value,
+    const individual_index_t& index
+) {
+  queue_modify([value](std::vector<A>& x) { x.push_back(value); }, index);
+}
+
+//' @title queue a value to be removed from the arrays of individuals given by a bitset
+template<class A>
+inline void RaggedVariable<A>::queue_remove(
+    const A value,
+    const individual_index_t& index
+) {
+  queue_modify([value](std::vector<A>& x) {
+    x.erase(std::remove(x.begin(), x.end(), value), x.end());
+  }, index);
+}
+
+//' @title queue values in some range [a,b] to be removed from the arrays of individuals given by a bitset
+template<class A>
+inline void RaggedVariable<A>::queue_remove_range(
+    const A a,
+    const A b,
+    const individual_index_t& index
+) {
+  queue_modify([a, b](std::vector<A>& x) {
+    x.erase(std::remove_if(x.begin(), x.end(), [a, b](const A v) {
+      return !(v < a) && !(b < v);
+    }), x.end());
+  }, index);
+}
+
+//' @title queue the arrays of individuals given by a bitset to be truncated
+//' @description arrays longer than length keep their first length elements
+template<class A>
+inline void RaggedVariable<A>::queue_truncate(
+    const size_t length,
+    const individual_index_t& index
+) {
+  queue_modify([length](std::vector<A>& x) {
+    if (x.size() > length) {
+      x.resize(length);
+    }
+  }, index);
 }
 
 //' @title apply all queued state updates in FIFO order
 template<class A>
 inline void RaggedVariable<A>::update() {
+  if (updates.size() > 0) {
+    ++version;
+  }
+  if (!inverted_index) {
     vector_update(updates, values);
+    return;
+  }
+  updates.apply(
+    size(),
+    [this](const size_t i, const std::vector<A>& value) {
+      inverted_index->remove(i, values[i]);
+      values[i] = value;
+      inverted_index->add(i, values[i]);
+    },
+    [this](const size_t i, const std::function<void(std::vector<A>&)>& modify) {
+      inverted_index->remove(i, values[i]);
+      modify(values[i]);
+      inverted_index->add(i, values[i]);
+    }
+  );
 }
 
 //' @title queue new values to add to the variable
@@ -174,6 +336,9 @@ template<class A>
 inline void RaggedVariable<A>::queue_extend(
     const std::vector<std::vector<A>>& new_values
 ) {
+  if (defer_update([=]() { queue_extend(new_values); })) {
+    return;
+  }
   extend_values.insert(
     extend_values.cend(),
     new_values.cbegin(),
@@ -186,8 +351,11 @@ template<class A>
 inline void RaggedVariable<A>::queue_shrink(
     const individual_index_t& index
 ) {
+  if (defer_update([=]() { queue_shrink(index); })) {
+    return;
+  }
   if (index.max_size() != size()) {
-    Rcpp::stop("Invalid bitset size for variable shrink");
+    raise_error("Invalid bitset size for variable shrink");
   }
   shrink_index |= index;
 }
@@ -197,9 +365,12 @@ template<class A>
 inline void RaggedVariable<A>::queue_shrink(
     const std::vector<size_t>& index
 ) {
+  if (defer_update([=]() { queue_shrink(index); })) {
+    return;
+  }
   for (const auto& x : index) {
     if (x >= size()) {
-      Rcpp::stop("Invalid vector index for variable shrink");
+      raise_error("Invalid vector index for variable shrink");
     }
   }
   shrink_index.insert(index.cbegin(), index.cend());
@@ -207,7 +378,49 @@ inline void RaggedVariable<A>::queue_shrink(
 
 template<class A>
 inline void RaggedVariable<A>::resize() {
-    resize_vector(values, shrink_index, extend_values);
+  if (!coordinated) {
+    resize(ResizePlan(shrink_index));
+  }
+}
+
+//' @title remove the individuals in a plan and apply queued extensions
+template<class A>
+inline void RaggedVariable<A>::resize(const ResizePlan& plan) {
+  if (!plan.empty() || extend_values.size() > 0) {
+    ++version;
+  }
+  if (!inverted_index) {
+    resize_vector(values, plan, shrink_index, extend_values);
+    return;
+  }
+  if (!plan.empty()) {
+    inverted_index->shrink(plan);
+  }
+  const auto first_new = plan.get_new_size();
+  inverted_index->extend(extend_values.size());
+  resize_vector(values, plan, shrink_index, extend_values);
+  for (auto i = first_new; i < size(); ++i) {
+    inverted_index->add(i, values[i]);
+  }
+}
+
+template<class A>
+inline const individual_index_t& RaggedVariable<A>::get_shrink_index() const {
+  return shrink_index;
+}
+
+//' @title remove individuals who have died from the inverted index
+//' @description they are found again once their arrays are updated, or if
+//' the index is rebuilt
+template<class A>
+inline void RaggedVariable<A>::tombstone(const individual_index_t& index) {
+  if (index.max_size() != size()) {
+    raise_error("Invalid bitset size for variable tombstone");
+  }
+  if (inverted_index && index.size() > 0) {
+    inverted_index->remove(index);
+    ++version;
+  }
 }
 
 template<class A>
@@ -215,4 +428,18 @@ inline size_t RaggedVariable<A>::size() const {
   return values.size();
 }
 
+//' @title the bytes held by the arrays, the inverted index, queued updates
+//' and resizes
+template<class A>
+inline memory_usage_t RaggedVariable<A>::memory_usage() const {
+  auto usage = memory_usage_t();
+  usage.storage = heap_bytes(values);
+  if (inverted_index) {
+    usage.storage += inverted_index->memory_usage();
+  }
+  usage.updates = updates.memory_usage();
+  usage.resizes = shrink_index.memory_usage() + heap_bytes(extend_values);
+  return usage;
+}
+
 #endif
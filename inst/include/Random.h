@@ -0,0 +1,108 @@
+/*
+ * Random.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_RANDOM_H_
+#define INST_INCLUDE_RANDOM_H_
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using rng_t = std::mt19937_64;
+
+//' @title a source of random numbers for code outside of a process stream
+//' @description the R package installs one which draws from R's random number
+//' generator (see RRandom.h), so that serial simulations are reproducible
+//' with set.seed. Without one, each thread draws from its own default seeded
+//' rng_t.
+struct RandomSource {
+    virtual double uniform() = 0;
+    virtual std::vector<double> uniforms(const size_t n) = 0;
+    virtual std::vector<int> sample(const int n, const int size) = 0;
+    virtual ~RandomSource() = default;
+};
+
+//' @title the random number stream of the process running on this thread
+//' @description processes run in parallel each draw from their own stream,
+//' so that their results do not depend on how they are spread over threads.
+//' Everywhere else this is null, and random numbers come from the installed
+//' RandomSource.
+inline rng_t*& process_rng() {
+    static thread_local rng_t* rng = nullptr;
+    return rng;
+}
+
+//' @title the installed source of random numbers, if any
+inline RandomSource*& random_source() {
+    static RandomSource* source = nullptr;
+    return source;
+}
+
+//' @title the stream to draw from on this thread when there is no source
+inline rng_t& default_rng() {
+    static thread_local rng_t rng;
+    return rng;
+}
+
+//' @title a uniform random number in (0, 1) from a stream
+inline double stream_uniform(rng_t& rng) {
+    auto x = 0.0;
+    while (x == 0.0) {
+        x = std::generate_canonical<double, 53>(rng);
+    }
+    return x;
+}
+
+//' @title the stream to draw from on this thread, or null to use the source
+inline rng_t* current_rng() {
+    auto rng = process_rng();
+    if (rng == nullptr && random_source() == nullptr) {
+        rng = &default_rng();
+    }
+    return rng;
+}
+
+//' @title a uniform random number in (0, 1)
+inline double random_uniform() {
+    auto rng = current_rng();
+    if (rng == nullptr) {
+        return random_source()->uniform();
+    }
+    return stream_uniform(*rng);
+}
+
+//' @title n uniform random numbers in (0, 1)
+inline std::vector<double> random_uniforms(const size_t n) {
+    auto rng = current_rng();
+    if (rng == nullptr) {
+        return random_source()->uniforms(n);
+    }
+    auto result = std::vector<double>(n);
+    for (auto& x : result) {
+        x = stream_uniform(*rng);
+    }
+    return result;
+}
+
+//' @title sample size integers from [0, n) without replacement
+inline std::vector<int> random_sample(const int n, const int size) {
+    auto rng = current_rng();
+    if (rng == nullptr) {
+        return random_source()->sample(n, size);
+    }
+    auto result = std::vector<int>(n);
+    for (auto i = 0; i < n; ++i) {
+        result[i] = i;
+    }
+    for (auto i = 0; i < size; ++i) {
+        auto j = std::uniform_int_distribution<int>(i, n - 1)(*rng);
+        std::swap(result[i], result[j]);
+    }
+    result.resize(size);
+    return result;
+}
+
+#endif /* INST_INCLUDE_RANDOM_H_ */
@@ -8,7 +8,9 @@
 #ifndef INST_INCLUDE_RENDER_VECTOR_H_
 #define INST_INCLUDE_RENDER_VECTOR_H_
 
-#include <Rcpp.h>
+#include "Error.h"
+#include <string>
+#include <vector>
 
 /**
  * A thin wrapper around a std::vector<double>, used to provide by-reference
@@ -21,7 +23,7 @@ struct RenderVector {
     void update(size_t index, double value) {
         // index is R-style 1-indexed, rather than C's 0-indexing.
         if (index < 1 || index > _data.size()) {
-            Rcpp::stop("index out-of-bounds");
+            raise_error("index out-of-bounds");
         }
         _data[index - 1] = value;
     }
@@ -0,0 +1,205 @@
+/*
+ * ResizeCoordinator.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_RESIZE_COORDINATOR_H_
+#define INST_INCLUDE_RESIZE_COORDINATOR_H_
+
+#include "Variable.h"
+#include "Event.h"
+#include "ResizePlan.h"
+#include "Error.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+#include <memory>
+
+class ResizeCoordinator;
+
+//' @title resizes a population's variables and events together
+//' @description Variables and events registered with a coordinator no longer
+//' resize themselves. Instead, the coordinator merges the shrinks queued on
+//' every object into one ResizePlan, and applies that plan to each of them,
+//' so the renumbering is computed once rather than once per object. Each
+//' object then applies its own queued extensions, which must add the same
+//' number of individuals to every object.
+//' The plan can either keep individuals in order, or move the last survivors
+//' into the removed slots, which moves far fewer individuals when the
+//' population is large. The last plan is kept so that indices held from
+//' before the resize can be remapped.
+//' Variables can be resized on a pool of threads kept for the lifetime of
+//' the coordinator, one task per variable. Events are always resized on the
+//' calling thread, since their queued extensions may schedule events and
+//' raise R errors.
+//' It contains the following data members:
+//'     * variables: the registered variables
+//'     * events: the registered targeted events
+//'     * shrink_index: individuals queued for removal from every object
+//'     * pool: the threads used to resize variables, if there is more than one
+//'     * ordered: whether resizing keeps individuals in order
+//'     * last_plan: the plan used by the last resize
+class ResizeCoordinator {
+    std::vector<Variable*> variables;
+    std::vector<TargetedEvent*> events;
+    individual_index_t shrink_index;
+    std::unique_ptr<ThreadPool> pool;
+    bool ordered;
+    ResizePlan last_plan;
+
+    void resize_variables(const ResizePlan& plan);
+
+public:
+    ResizeCoordinator(
+        const size_t size,
+        const size_t threads,
+        const bool ordered = true
+    );
+    virtual ~ResizeCoordinator() = default;
+
+    virtual void add_variable(Variable&);
+    virtual void add_event(TargetedEvent&);
+    virtual void queue_shrink(const individual_index_t&);
+    virtual bool has_queued_shrink() const;
+    virtual void tombstone(const individual_index_t&);
+    virtual size_t size() const;
+    virtual void resize();
+    virtual const ResizePlan& get_last_plan() const;
+};
+
+inline ResizeCoordinator::ResizeCoordinator(
+    const size_t size,
+    const size_t threads,
+    const bool ordered
+) : shrink_index(individual_index_t(size)),
+    ordered(ordered),
+    last_plan(ResizePlan(size)) {
+    if (threads == 0) {
+        raise_error("a resize coordinator needs at least one thread");
+    }
+    if (threads > 1) {
+        pool.reset(new ThreadPool(threads));
+    }
+}
+
+//' @title register a variable, which will only be resized by this coordinator
+inline void ResizeCoordinator::add_variable(Variable& variable) {
+    if (variable.size() != size()) {
+        raise_error("variables registered for resizing must be the population size");
+    }
+    variable.set_coordinated();
+    variables.push_back(&variable);
+}
+
+//' @title register an event, which will only be resized by this coordinator
+inline void ResizeCoordinator::add_event(TargetedEvent& event) {
+    if (event.size() != size()) {
+        raise_error("events registered for resizing must be the population size");
+    }
+    event.set_coordinated();
+    events.push_back(&event);
+}
+
+//' @title queue individuals to be removed from every registered object
+inline void ResizeCoordinator::queue_shrink(const individual_index_t& index) {
+    if (index.max_size() != size()) {
+        raise_error("Invalid bitset size for population shrink");
+    }
+    shrink_index |= index;
+}
+
+//' @title have individuals been queued for removal on any registered object?
+inline bool ResizeCoordinator::has_queued_shrink() const {
+    for (const auto variable : variables) {
+        if (variable->get_shrink_index().size() > 0) {
+            return true;
+        }
+    }
+    for (const auto event : events) {
+        if (event->get_shrink_index().size() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//' @title remove individuals who have died from every registered variable's
+//' category bitsets and indices, without resizing anything
+inline void ResizeCoordinator::tombstone(const individual_index_t& index) {
+    if (index.max_size() != size()) {
+        raise_error("Invalid bitset size for tombstone");
+    }
+    for (auto variable : variables) {
+        variable->tombstone(index);
+    }
+}
+
+inline size_t ResizeCoordinator::size() const {
+    return shrink_index.max_size();
+}
+
+//' @title resize every registered variable with the plan, one task per variable
+inline void ResizeCoordinator::resize_variables(const ResizePlan& plan) {
+    if (!pool || variables.size() <= 1) {
+        for (auto variable : variables) {
+            variable->resize(plan);
+        }
+        return;
+    }
+    auto tasks = std::vector<task_t>();
+    tasks.reserve(variables.size());
+    for (auto variable : variables) {
+        tasks.push_back(traced_task(
+            [variable, &plan]() { variable->resize(plan); },
+            "variable_resize",
+            "resize"
+        ));
+    }
+    pool->run(tasks);
+}
+
+//' @title apply queued shrinks and extensions to every registered object
+inline void ResizeCoordinator::resize() {
+    auto removed = shrink_index;
+    for (const auto variable : variables) {
+        const auto& index = variable->get_shrink_index();
+        if (index.size() > 0) {
+            removed |= index;
+        }
+    }
+    for (const auto event : events) {
+        removed |= event->get_shrink_index();
+    }
+    last_plan = ResizePlan(removed, ordered);
+    const auto& plan = last_plan;
+
+    for (auto event : events) {
+        event->resize(plan);
+    }
+    resize_variables(plan);
+
+    auto new_size = plan.get_new_size();
+    if (!variables.empty()) {
+        new_size = variables.front()->size();
+    } else if (!events.empty()) {
+        new_size = events.front()->size();
+    }
+    for (const auto variable : variables) {
+        if (variable->size() != new_size) {
+            raise_error("registered objects were extended by different amounts");
+        }
+    }
+    for (const auto event : events) {
+        if (event->size() != new_size) {
+            raise_error("registered objects were extended by different amounts");
+        }
+    }
+    shrink_index = individual_index_t(new_size);
+}
+
+//' @title get the plan used by the last resize, mapping old positions to new
+inline const ResizePlan& ResizeCoordinator::get_last_plan() const {
+    return last_plan;
+}
+
+#endif /* INST_INCLUDE_RESIZE_COORDINATOR_H_ */
@@ -0,0 +1,237 @@
+/*
+ * ResizePlan.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_RESIZE_PLAN_H_
+#define INST_INCLUDE_RESIZE_PLAN_H_
+
+#include "common_types.h"
+#include "vector_variables.h"
+
+class ResizePlan;
+
+//' @title the renumbering of a population after removing some individuals
+//' @description This class computes, once, where every surviving individual
+//' moves to when a set of individuals is removed, so that the same plan can
+//' be applied to every variable and event in a population.
+//' An ordered plan keeps the survivors in order. The number of individuals
+//' removed before each word of the removal bitset is stored, so the new
+//' position of a survivor is that prefix count plus a popcount within its
+//' word, and words without removals are moved as a whole.
+//' An unordered plan fills each removed slot below the new size with one of
+//' the survivors above it, so only as many individuals move as are removed.
+//' It contains the following data members:
+//'     * removed: the individuals to remove
+//'     * removed_before: the number of individuals removed before each word
+//'     * moves: for unordered plans, the survivors which move and where to
+//'     * old_size: the size of the population before removal
+//'     * ordered: whether survivors keep their order
+class ResizePlan {
+    individual_index_t removed;
+    std::vector<size_t> removed_before;
+    std::vector<std::pair<size_t, size_t>> moves;
+    size_t old_size;
+    bool ordered;
+
+public:
+    ResizePlan(const individual_index_t& removed, const bool ordered = true);
+    ResizePlan(const size_t size);
+
+    bool empty() const;
+    bool is_ordered() const;
+    bool is_removed(const size_t i) const;
+    size_t get_old_size() const;
+    size_t get_new_size() const;
+    const individual_index_t& get_removed() const;
+    const std::vector<std::pair<size_t, size_t>>& get_moves() const;
+    size_t map(const size_t i) const;
+
+    void shrink(individual_index_t& bitset) const;
+    template<class T>
+    void shrink(std::vector<T>& values) const;
+};
+
+//' @title plan the removal of a set of individuals
+//' @description for an unordered plan, the survivors above the new size are
+//' paired, in order, with the removed slots below it.
+inline ResizePlan::ResizePlan(
+    const individual_index_t& to_remove,
+    const bool ordered
+) : removed(to_remove.empty() ? individual_index_t(0) : to_remove),
+    old_size(to_remove.max_size()),
+    ordered(ordered) {
+    if (to_remove.empty()) {
+        return;
+    }
+    if (!ordered) {
+        const auto new_size = get_new_size();
+        auto hole = removed.cbegin();
+        for (auto i = new_size; i < old_size; ++i) {
+            if (!is_removed(i)) {
+                moves.push_back({i, *hole});
+                ++hole;
+            }
+        }
+        return;
+    }
+    removed_before = std::vector<size_t>(removed.n_words());
+    auto total = size_t(0);
+    for (auto w = 0u; w < removed.n_words(); ++w) {
+        removed_before[w] = total;
+        total += popcount(removed.word(w));
+    }
+}
+
+//' @title plan to remove nobody from a population of some size
+inline ResizePlan::ResizePlan(const size_t size)
+    : removed(individual_index_t(0)), old_size(size), ordered(true) {}
+
+inline bool ResizePlan::empty() const {
+    return removed.empty();
+}
+
+inline bool ResizePlan::is_ordered() const {
+    return ordered;
+}
+
+inline bool ResizePlan::is_removed(const size_t i) const {
+    return !empty() && removed.find(i) != removed.cend();
+}
+
+inline size_t ResizePlan::get_old_size() const {
+    return old_size;
+}
+
+inline size_t ResizePlan::get_new_size() const {
+    return old_size - removed.size();
+}
+
+inline const individual_index_t& ResizePlan::get_removed() const {
+    return removed;
+}
+
+//' @title the survivors which an unordered plan moves, and where to
+inline const std::vector<std::pair<size_t, size_t>>& ResizePlan::get_moves() const {
+    return moves;
+}
+
+//' @title the new position of a surviving individual i
+inline size_t ResizePlan::map(const size_t i) const {
+    if (empty()) {
+        return i;
+    }
+    if (!ordered) {
+        if (i < get_new_size()) {
+            return i;
+        }
+        const auto move = std::lower_bound(
+            moves.cbegin(),
+            moves.cend(),
+            std::make_pair(i, size_t(0))
+        );
+        return move->second;
+    }
+    const auto word_bits = sizeof(removed.word(0)) * 8;
+    const auto w = i / word_bits;
+    const auto below = (uint64_t(1) << (i % word_bits)) - 1;
+    return i - removed_before[w] - popcount(removed.word(w) & below);
+}
+
+//' @title remove the planned individuals from a bitset
+//' @description the bitset must have the old size of the plan. For ordered
+//' plans, words without removals are shifted down by their prefix count as a
+//' whole, the survivors in other words are moved one at a time. Unordered
+//' plans copy the moved bits and truncate the bitset in place.
+inline void ResizePlan::shrink(individual_index_t& bitset) const {
+    if (empty()) {
+        return;
+    }
+    if (!ordered) {
+        for (const auto& move : moves) {
+            if (bitset.find(move.first) != bitset.cend()) {
+                bitset.insert(move.second);
+            } else {
+                bitset.erase(move.second);
+            }
+        }
+        bitset.truncate(get_new_size());
+        return;
+    }
+    const auto word_bits = sizeof(removed.word(0)) * 8;
+    auto result = individual_index_t(get_new_size());
+    auto words = std::vector<uint64_t>(result.n_words(), 0);
+    for (auto w = 0u; w < bitset.n_words(); ++w) {
+        const auto removals = removed.word(w);
+        auto word = bitset.word(w) & ~removals;
+        if (word == 0) {
+            continue;
+        }
+        if (removals == 0) {
+            const auto start = w * word_bits - removed_before[w];
+            const auto shift = start % word_bits;
+            words[start / word_bits] |= word << shift;
+            if (shift != 0 && start / word_bits + 1 < words.size()) {
+                words[start / word_bits + 1] |= word >> (word_bits - shift);
+            }
+            continue;
+        }
+        while (word != 0) {
+            const auto position = map(w * word_bits + ctz(word));
+            words[position / word_bits] |= uint64_t(1) << (position % word_bits);
+            word &= word - 1;
+        }
+    }
+    for (auto w = 0u; w < words.size(); ++w) {
+        if (words[w] != 0) {
+            result.set_word(w, words[w]);
+        }
+    }
+    bitset = std::move(result);
+}
+
+//' @title remove the planned individuals from a vector of values
+template<class T>
+inline void ResizePlan::shrink(std::vector<T>& values) const {
+    if (empty()) {
+        return;
+    }
+    if (!ordered) {
+        for (const auto& move : moves) {
+            values[move.second] = std::move(values[move.first]);
+        }
+        values.erase(values.begin() + get_new_size(), values.end());
+        return;
+    }
+    shrink_vector(values, removed);
+}
+
+//' @title Resize a vector-based variable following a plan
+//' @description removes the planned individuals, appends extend_values and
+//' resets the variable's shrink_index to its new size.
+//' @param values a vector-based variable's value vector
+//' @param plan the individuals to remove
+//' @param shrink_index the variable's queued removals, which the plan covers
+//' @param extend_values values to append to the values vector
+template<class A>
+inline void resize_vector(
+    std::vector<A>& values,
+    const ResizePlan& plan,
+    individual_index_t& shrink_index,
+    std::vector<A>& extend_values
+) {
+    if (plan.empty() && extend_values.empty()) {
+        return;
+    }
+    plan.shrink(values);
+    values.insert(
+        values.cend(),
+        std::make_move_iterator(extend_values.begin()),
+        std::make_move_iterator(extend_values.end())
+    );
+    extend_values.clear();
+    shrink_index = individual_index_t(values.size());
+}
+
+#endif /* INST_INCLUDE_RESIZE_PLAN_H_ */
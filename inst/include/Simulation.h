@@ -0,0 +1,542 @@
+/*
+ * Simulation.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_SIMULATION_H_
+#define INST_INCLUDE_SIMULATION_H_
+
+#include "common_types.h"
+#include "Variable.h"
+#include "Event.h"
+#include "Deferred.h"
+#include "Random.h"
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include "memory_usage.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+
+using phase_t = std::function<void ()>;
+using memory_phase_t = std::function<memory_usage_t ()>;
+
+class Simulation;
+
+//' @title a simulation loop run in C++
+//' @description This class runs the same phases as the R simulation_loop, in
+//' the same order, without dispatching each of them through R on every
+//' timestep: on each timestep the processes are run, then the listeners of
+//' every triggered event, then the variables are updated, the events and then
+//' the variables are resized, and finally the events move to the next
+//' timestep.
+//' Variables which need to run R code to update or resize, such as a
+//' Population, can be added as a pair of phase functions instead. Processes
+//' and listeners are std::functions, so the caller can wrap R closures in
+//' them, and they are called in the order that they were added.
+//' If the simulation has a thread pool, each run of consecutive processes
+//' marked as parallel is run as one batch on the pool. Each process in the
+//' batch queues its changes to variables and events into its own buffer and
+//' draws random numbers from its own stream, and the buffers are replayed in
+//' process order after the batch, so the results are the same for any number
+//' of threads. Parallel processes must only read variables and queue changes,
+//' and must not call R.
+//' With a thread pool, the variables are also updated and then resized as
+//' batches on the pool, with large updates split over several threads. The
+//' variables are independent of each other, so this gives the same results as
+//' updating them one after another. Variables added as phase functions are
+//' updated and resized on the calling thread after the others.
+//' If the simulation has a profiler, the time taken by each process, listener
+//' and variable update and resize is recorded on every timestep, under the
+//' name it was added with. If a trace is being recorded when the simulation
+//' is run (see Trace.h), each timestep and each of these phases are traced as
+//' slices, with parallel processes traced on the threads which ran them. When
+//' either is used with a thread pool, the variables are updated one at a time,
+//' each still split over the pool, so that they can be timed separately.
+//' If the simulation has a memory report, the memory held by each variable
+//' and event is recorded on its reported timesteps, after the listeners have
+//' run and before the variables are updated, when the queued updates and
+//' resizes are largest. Variables added as phase functions are only reported
+//' if they were added with a memory function.
+//' It contains the following data members:
+//'     * processes: the processes run at the start of each timestep
+//'     * parallel: whether each process can be run in parallel
+//'     * streams: the random number stream of each process
+//'     * pool: the threads which run parallel processes and update variables, if
+//'       any
+//'     * seed: the seed from which the streams are derived
+//'     * variables: the variables which are updated and resized in C++
+//'     * updates: the update phase of each variable which runs R code
+//'     * resizes: the resize phase of each variable which runs R code
+//'     * memory_usages: the memory function of each variable which runs R
+//'       code, which may be empty
+//'     * events: the events, which are processed, resized and ticked
+//'     * listeners: the listeners of each event
+//'     * check_interrupt: called after each timestep, so that the caller can
+//'       stop the simulation by throwing, if set
+//'     * profiler: records the time taken by each phase, if set
+//'     * memory_report: records the memory held by each variable and event,
+//'       if set
+//'     * tracer: the trace recorder of the current run, if any
+//'     * process_names, variable_names, phase_names, event_names: the names
+//'       that the processes, variables, variables added as phase functions and
+//'       events were added with
+//'     * ids: the id of each phase in the tables below, while timed
+//'     * profiler_ids: the id of each phase in the profiler
+//'     * trace_names, trace_categories: the name and kind of each phase in the
+//'       trace
+class Simulation {
+    std::vector<process_t> processes;
+    std::vector<bool> parallel;
+    std::vector<rng_t> streams;
+    std::unique_ptr<ThreadPool> pool;
+    uint64_t seed;
+    std::vector<Variable*> variables;
+    std::vector<phase_t> updates;
+    std::vector<phase_t> resizes;
+    std::vector<memory_phase_t> memory_usages;
+    std::vector<EventBase*> events;
+    std::vector<std::vector<listener_t>> listeners;
+    phase_t check_interrupt;
+    Profiler* profiler = nullptr;
+    MemoryReport* memory_report = nullptr;
+    TraceRecorder* tracer = nullptr;
+    std::vector<std::string> process_names;
+    std::vector<std::string> variable_names;
+    std::vector<std::string> phase_names;
+    std::vector<std::string> event_names;
+
+    //' @title the ids of each phase
+    struct phase_ids_t {
+        std::vector<size_t> processes;
+        std::vector<std::vector<size_t>> listeners;
+        std::vector<size_t> variable_updates;
+        std::vector<size_t> variable_resizes;
+        std::vector<size_t> phase_updates;
+        std::vector<size_t> phase_resizes;
+    } ids;
+    std::vector<size_t> profiler_ids;
+    std::vector<const char*> trace_names;
+    std::vector<const char*> trace_categories;
+
+    bool timed() const;
+    size_t add_phase(const char* kind, const std::string& name);
+    void register_phases();
+    void record_phase(
+        const size_t t,
+        const size_t phase,
+        const profile_clock_t::time_point start,
+        const profile_clock_t::time_point end
+    );
+    template<class F>
+    void time_phase(const size_t t, const size_t phase, F&& f);
+    void run_processes(const size_t t);
+    void run_parallel(const size_t begin, const size_t end, const size_t t);
+    void run_listeners();
+    void update_variables(const size_t t);
+    void resize_variables(const size_t t);
+    void report_memory(const size_t t);
+
+public:
+    Simulation(const size_t threads = 0, const uint64_t seed = 0);
+    virtual ~Simulation() = default;
+
+    virtual void add_process(
+        const process_t&,
+        const bool parallel = false,
+        const std::string& name = ""
+    );
+    virtual void add_variable(Variable&, const std::string& name = "");
+    virtual void add_variable(
+        const phase_t& update,
+        const phase_t& resize,
+        const std::string& name = "",
+        const memory_phase_t& memory_usage = nullptr
+    );
+    virtual void add_event(
+        EventBase&,
+        const std::vector<listener_t>&,
+        const std::string& name = ""
+    );
+    virtual void set_interrupt_check(const phase_t&);
+    virtual void set_profiler(Profiler&);
+    virtual void set_memory_report(MemoryReport&);
+    virtual void run(const size_t start, const size_t end);
+};
+
+//' @title bind a targeted listener to the current target of its event
+inline listener_t bind_target(
+    TargetedEvent& event,
+    const targeted_listener_t& listener
+) {
+    return [&event, listener](size_t t) {
+        listener(t, event.current_target());
+    };
+}
+
+//' @title create a simulation
+//' @param threads the number of threads to run parallel processes and update
+//' variables on, or 0 to run everything on the calling thread and draw random numbers from R
+//' @param seed the seed for the random number streams of parallel processes
+inline Simulation::Simulation(const size_t threads, const uint64_t seed)
+    : pool(threads == 0 ? nullptr : new ThreadPool(threads)), seed(seed) {}
+
+//' @title the name to give a phase added without one
+inline std::string default_name(
+    const std::string& name,
+    const std::string& prefix,
+    const size_t n
+) {
+    return name.empty() ? prefix + "_" + std::to_string(n) : name;
+}
+
+inline void Simulation::add_process(
+    const process_t& process,
+    const bool is_parallel,
+    const std::string& name
+) {
+    process_names.push_back(default_name(name, "process", processes.size() + 1));
+    processes.push_back(process);
+    parallel.push_back(is_parallel);
+    std::seed_seq sequence{
+        static_cast<uint32_t>(seed),
+        static_cast<uint32_t>(seed >> 32),
+        static_cast<uint32_t>(streams.size())
+    };
+    streams.emplace_back(sequence);
+}
+
+inline void Simulation::add_variable(Variable& variable, const std::string& name) {
+    variable_names.push_back(default_name(
+        name,
+        "variable",
+        variables.size() + updates.size() + 1
+    ));
+    variables.push_back(&variable);
+}
+
+//' @title add a variable which runs R code to update and resize
+//' @param memory_usage estimates the memory held by the variable, if set
+inline void Simulation::add_variable(
+    const phase_t& update,
+    const phase_t& resize,
+    const std::string& name,
+    const memory_phase_t& memory_usage
+) {
+    phase_names.push_back(default_name(
+        name,
+        "variable",
+        variables.size() + updates.size() + 1
+    ));
+    updates.push_back(update);
+    resizes.push_back(resize);
+    memory_usages.push_back(memory_usage);
+}
+
+//' @title add an event and its listeners, which are called with the event's
+//' timestep
+inline void Simulation::add_event(
+    EventBase& event,
+    const std::vector<listener_t>& event_listeners,
+    const std::string& name
+) {
+    event_names.push_back(default_name(name, "event", events.size() + 1));
+    events.push_back(&event);
+    listeners.push_back(event_listeners);
+}
+
+inline void Simulation::set_interrupt_check(const phase_t& check) {
+    check_interrupt = check;
+}
+
+//' @title record the time taken by each phase in a profiler
+//' @description the profiler must outlive the simulation's runs
+inline void Simulation::set_profiler(Profiler& p) {
+    profiler = &p;
+}
+
+//' @title record the memory held by each variable and event in a report
+//' @description the report must outlive the simulation's runs
+inline void Simulation::set_memory_report(MemoryReport& report) {
+    memory_report = &report;
+}
+
+//' @title whether the phases are being profiled or traced
+inline bool Simulation::timed() const {
+    return profiler != nullptr || tracer != nullptr;
+}
+
+//' @title add a phase to the profiler and the trace, and get its id
+inline size_t Simulation::add_phase(const char* kind, const std::string& name) {
+    if (profiler) {
+        profiler_ids.push_back(profiler->add_phase(kind, name));
+    }
+    if (tracer) {
+        trace_names.push_back(tracer->intern(name));
+        trace_categories.push_back(kind);
+    }
+    return std::max(profiler_ids.size(), trace_names.size()) - 1;
+}
+
+//' @title register every phase with the profiler and the trace
+//' @description listeners are named after their event and their position in
+//' its listeners, as in "recovery[1]"
+inline void Simulation::register_phases() {
+    ids = phase_ids_t();
+    profiler_ids.clear();
+    trace_names.clear();
+    trace_categories.clear();
+    for (const auto& name : process_names) {
+        ids.processes.push_back(add_phase("process", name));
+    }
+    for (auto i = 0u; i < events.size(); ++i) {
+        ids.listeners.emplace_back();
+        for (auto j = 0u; j < listeners[i].size(); ++j) {
+            ids.listeners[i].push_back(add_phase(
+                "listener",
+                event_names[i] + "[" + std::to_string(j + 1) + "]"
+            ));
+        }
+    }
+    for (const auto& name : variable_names) {
+        ids.variable_updates.push_back(add_phase("update", name));
+        ids.variable_resizes.push_back(add_phase("resize", name));
+    }
+    for (const auto& name : phase_names) {
+        ids.phase_updates.push_back(add_phase("update", name));
+        ids.phase_resizes.push_back(add_phase("resize", name));
+    }
+}
+
+inline void Simulation::record_phase(
+    const size_t t,
+    const size_t phase,
+    const profile_clock_t::time_point start,
+    const profile_clock_t::time_point end
+) {
+    if (profiler) {
+        profiler->record(
+            t,
+            profiler_ids[phase],
+            std::chrono::duration<double>(end - start).count()
+        );
+    }
+    if (tracer) {
+        tracer->record(trace_names[phase], trace_categories[phase], start, end, t);
+    }
+}
+
+//' @title call f and record how long it took
+template<class F>
+inline void Simulation::time_phase(const size_t t, const size_t phase, F&& f) {
+    const auto start = profile_clock_t::now();
+    f();
+    record_phase(t, phase, start, profile_clock_t::now());
+}
+
+//' @title run the processes, batching consecutive parallel ones
+inline void Simulation::run_processes(const size_t t) {
+    auto i = size_t(0);
+    while (i < processes.size()) {
+        if (!pool || !parallel[i]) {
+            if (timed()) {
+                time_phase(t, ids.processes[i], [&]() { processes[i](t); });
+            } else {
+                processes[i](t);
+            }
+            ++i;
+            continue;
+        }
+        auto end = i;
+        while (end < processes.size() && parallel[end]) {
+            ++end;
+        }
+        run_parallel(i, end, t);
+        i = end;
+    }
+}
+
+//' @title run processes [begin, end) on the pool and replay their changes
+inline void Simulation::run_parallel(
+    const size_t begin,
+    const size_t end,
+    const size_t t
+) {
+    auto buffers = std::vector<deferred_t>(end - begin);
+    auto elapsed = std::vector<double>(end - begin);
+    auto tasks = std::vector<task_t>();
+    tasks.reserve(end - begin);
+    for (auto i = begin; i < end; ++i) {
+        tasks.push_back([this, &buffers, &elapsed, begin, i, t]() {
+            struct scope {
+                scope(deferred_t* buffer, rng_t* rng) {
+                    deferred_updates() = buffer;
+                    process_rng() = rng;
+                }
+                ~scope() {
+                    deferred_updates() = nullptr;
+                    process_rng() = nullptr;
+                }
+            } guard(&buffers[i - begin], &streams[i]);
+            const auto start = profile_clock_t::now();
+            processes[i](t);
+            const auto finish = profile_clock_t::now();
+            elapsed[i - begin] = std::chrono::duration<double>(finish - start).count();
+            // traced here, so that the slice is on the thread which ran it
+            if (tracer) {
+                tracer->record(
+                    trace_names[ids.processes[i]],
+                    "process",
+                    start,
+                    finish,
+                    t
+                );
+            }
+        });
+    }
+    pool->run(tasks);
+    if (profiler) {
+        for (auto i = begin; i < end; ++i) {
+            profiler->record(t, profiler_ids[ids.processes[i]], elapsed[i - begin]);
+        }
+    }
+    replay_deferred(buffers);
+}
+
+//' @title call the listeners of each triggered event
+//' @description each listener is only called if its event still triggers, so
+//' that a listener can stop the ones after it by clearing the schedule.
+inline void Simulation::run_listeners() {
+    for (auto i = 0u; i < events.size(); ++i) {
+        for (auto j = 0u; j < listeners[i].size(); ++j) {
+            if (!events[i]->should_trigger()) {
+                continue;
+            }
+            const auto time = events[i]->get_time();
+            if (timed()) {
+                time_phase(time, ids.listeners[i][j], [&]() {
+                    listeners[i][j](time);
+                });
+            } else {
+                listeners[i][j](time);
+            }
+        }
+    }
+}
+
+inline void Simulation::update_variables(const size_t t) {
+    if (timed()) {
+        for (auto i = 0u; i < variables.size(); ++i) {
+            time_phase(t, ids.variable_updates[i], [&]() {
+                if (pool) {
+                    ::update_variables({variables[i]}, *pool);
+                } else {
+                    variables[i]->update();
+                }
+            });
+        }
+        for (auto i = 0u; i < updates.size(); ++i) {
+            time_phase(t, ids.phase_updates[i], updates[i]);
+        }
+        return;
+    }
+    if (pool) {
+        ::update_variables(variables, *pool);
+    } else {
+        for (auto variable : variables) {
+            variable->update();
+        }
+    }
+    for (const auto& update : updates) {
+        update();
+    }
+}
+
+inline void Simulation::resize_variables(const size_t t) {
+    if (timed()) {
+        for (auto i = 0u; i < variables.size(); ++i) {
+            time_phase(t, ids.variable_resizes[i], [&]() {
+                if (pool) {
+                    ::resize_variables({variables[i]}, *pool);
+                } else {
+                    variables[i]->resize();
+                }
+            });
+        }
+        for (auto i = 0u; i < resizes.size(); ++i) {
+            time_phase(t, ids.phase_resizes[i], resizes[i]);
+        }
+        return;
+    }
+    if (pool) {
+        ::resize_variables(variables, *pool);
+    } else {
+        for (auto variable : variables) {
+            variable->resize();
+        }
+    }
+    for (const auto& resize : resizes) {
+        resize();
+    }
+}
+
+//' @title record the memory held by each variable and event, if t is reported
+inline void Simulation::report_memory(const size_t t) {
+    if (!memory_report || !memory_report->should_report(t)) {
+        return;
+    }
+    for (auto i = 0u; i < variables.size(); ++i) {
+        memory_report->record(
+            t,
+            "variable",
+            variable_names[i],
+            variables[i]->memory_usage()
+        );
+    }
+    for (auto i = 0u; i < memory_usages.size(); ++i) {
+        if (memory_usages[i]) {
+            memory_report->record(t, "variable", phase_names[i], memory_usages[i]());
+        }
+    }
+    for (auto i = 0u; i < events.size(); ++i) {
+        memory_report->record(t, "event", event_names[i], events[i]->memory_usage());
+    }
+}
+
+//' @title run the simulation from timestep start to end inclusive
+inline void Simulation::run(const size_t start, const size_t end) {
+    tracer = trace_recorder().load();
+    if (timed()) {
+        register_phases();
+    }
+    for (auto t = start; t <= end; ++t) {
+        const auto timestep_start = profile_clock_t::now();
+        run_processes(t);
+        run_listeners();
+        report_memory(t);
+        update_variables(t);
+        for (auto event : events) {
+            event->resize();
+        }
+        resize_variables(t);
+        for (auto event : events) {
+            event->tick();
+        }
+        if (tracer) {
+            tracer->record(
+                "timestep",
+                "simulation",
+                timestep_start,
+                profile_clock_t::now(),
+                t
+            );
+        }
+        if (check_interrupt) {
+            check_interrupt();
+        }
+    }
+}
+
+#endif /* INST_INCLUDE_SIMULATION_H_ */
@@ -0,0 +1,177 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_THREAD_POOL_H_
+#define INST_INCLUDE_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using task_t = std::function<void ()>;
+
+class ThreadPool;
+
+//' @title a work-stealing pool of threads for running batches of tasks
+//' @description The calling thread and threads - 1 workers run each batch.
+//' The tasks are dealt out round robin to a deque per thread. Each thread
+//' takes tasks from the front of its own deque, and once that is empty
+//' steals from the back of the others, so one slow task does not hold up
+//' the rest of a thread's share. The workers are kept for the lifetime of
+//' the pool and sleep between batches.
+//' Tasks must not call R. If any tasks throw, the exception of the first of
+//' them in batch order is rethrown on the calling thread.
+//' It contains the following data members:
+//'     * workers: the worker threads
+//'     * queues: the indices of the tasks left for each thread
+//'     * queue_mutexes: a mutex guarding each deque
+//'     * tasks: the current batch
+//'     * errors: the exception thrown by each task in the batch, if any
+//'     * generation: the number of batches started, which wakes the workers
+//'     * pending: the number of tasks in the batch not yet finished
+//'     * stopping: set when the pool is destroyed
+class ThreadPool {
+    std::vector<std::thread> workers;
+    std::vector<std::deque<size_t>> queues;
+    std::vector<std::unique_ptr<std::mutex>> queue_mutexes;
+    const std::vector<task_t>* tasks = nullptr;
+    std::vector<std::exception_ptr> errors;
+    size_t generation = 0;
+    size_t pending = 0;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+
+    bool take(const size_t thread, size_t& task);
+    void work(const size_t thread);
+    void worker_loop(const size_t thread);
+
+public:
+    ThreadPool(const size_t threads);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    virtual ~ThreadPool();
+
+    virtual size_t size() const;
+    virtual void run(const std::vector<task_t>& batch);
+};
+
+inline ThreadPool::ThreadPool(const size_t threads)
+    : queues(threads == 0 ? 1 : threads) {
+    for (auto i = 0u; i < queues.size(); ++i) {
+        queue_mutexes.emplace_back(new std::mutex());
+    }
+    for (auto i = 1u; i < queues.size(); ++i) {
+        workers.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+//' @title the number of threads which run each batch, including the caller
+inline size_t ThreadPool::size() const {
+    return queues.size();
+}
+
+//' @title take the next task for a thread, stealing one if its deque is empty
+inline bool ThreadPool::take(const size_t thread, size_t& task) {
+    {
+        std::lock_guard<std::mutex> lock(*queue_mutexes[thread]);
+        if (!queues[thread].empty()) {
+            task = queues[thread].front();
+            queues[thread].pop_front();
+            return true;
+        }
+    }
+    for (auto i = 1u; i < queues.size(); ++i) {
+        const auto victim = (thread + i) % queues.size();
+        std::lock_guard<std::mutex> lock(*queue_mutexes[victim]);
+        if (!queues[victim].empty()) {
+            task = queues[victim].back();
+            queues[victim].pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+//' @title run tasks until none are left to take
+inline void ThreadPool::work(const size_t thread) {
+    auto task = size_t(0);
+    while (take(thread, task)) {
+        try {
+            (*tasks)[task]();
+        } catch (...) {
+            errors[task] = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) {
+            finished.notify_all();
+        }
+    }
+}
+
+inline void ThreadPool::worker_loop(const size_t thread) {
+    auto seen = size_t(0);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        work(thread);
+    }
+}
+
+//' @title run a batch of tasks, returning once they have all finished
+inline void ThreadPool::run(const std::vector<task_t>& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks = &batch;
+        errors.assign(batch.size(), nullptr);
+        pending = batch.size();
+        for (auto i = 0u; i < batch.size(); ++i) {
+            std::lock_guard<std::mutex> queue_lock(*queue_mutexes[i % queues.size()]);
+            queues[i % queues.size()].push_back(i);
+        }
+        ++generation;
+    }
+    wake.notify_all();
+    work(0);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]() { return pending == 0; });
+        tasks = nullptr;
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+#endif /* INST_INCLUDE_THREAD_POOL_H_ */
@@ -0,0 +1,165 @@
+/*
+ * TimeVariable.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_TIME_VARIABLE_H_
+#define INST_INCLUDE_TIME_VARIABLE_H_
+
+#include "IntegerVariable.h"
+#include <limits>
+
+struct TimeVariable;
+
+//' @title direction in which time is measured from the anchor
+//' @description `since` gives t - anchor (e.g. age from a birth timestep),
+//' `until` gives anchor - t (e.g. time remaining until a scheduled timestep).
+enum class time_direction {
+    since,
+    until
+};
+
+//' @title a variable object for time elapsed since (or until) an anchor
+//' @description This class stores an anchor timestep for each individual and
+//' derives the time since or until that anchor lazily at query time, so that
+//' nothing needs to be written to the variable on each timestep. The anchors
+//' themselves are stored and updated as in IntegerVariable, which it inherits.
+//' Queries on the derived time are rewritten as queries on the anchor values.
+//' It contains the following data members:
+//'     * direction: whether derived values are time since or until the anchor
+struct TimeVariable : public IntegerVariable {
+    const time_direction direction;
+
+    TimeVariable(const std::vector<int>& anchors, const time_direction direction);
+    virtual ~TimeVariable() = default;
+
+    virtual std::vector<int> get_time_values(const int t) const;
+    virtual std::vector<int> get_time_values(const int t, const individual_index_t&) const;
+    virtual std::vector<int> get_time_values(const int t, const std::vector<size_t>&) const;
+
+    virtual individual_index_t get_index_of_time_set(const int t, const std::vector<int>&) const;
+    virtual individual_index_t get_index_of_time_range(const int t, const int a, const int b) const;
+
+    virtual size_t get_size_of_time_set(const int t, const std::vector<int>&) const;
+    virtual size_t get_size_of_time_range(const int t, const int a, const int b) const;
+
+private:
+    int to_time(const int t, const int anchor) const;
+    int to_anchor(const int t, const int time) const;
+};
+
+inline TimeVariable::TimeVariable(
+    const std::vector<int>& anchors,
+    const time_direction direction
+) : IntegerVariable(anchors), direction(direction) {}
+
+//' @title convert an anchor value to a time at timestep t
+inline int TimeVariable::to_time(const int t, const int anchor) const {
+    if (direction == time_direction::since) {
+        return t - anchor;
+    }
+    return anchor - t;
+}
+
+//' @title convert a time at timestep t to the anchor value which produces it
+//' @description the result is clamped to the range of int, which keeps range
+//' bounds such as .Machine$integer.max meaningful after the rewrite
+inline int TimeVariable::to_anchor(const int t, const int time) const {
+    const auto anchor = direction == time_direction::since ?
+        static_cast<long long>(t) - time :
+        static_cast<long long>(t) + time;
+    if (anchor > std::numeric_limits<int>::max()) {
+        return std::numeric_limits<int>::max();
+    }
+    if (anchor < std::numeric_limits<int>::min()) {
+        return std::numeric_limits<int>::min();
+    }
+    return static_cast<int>(anchor);
+}
+
+//' @title get the derived time for all individuals at timestep t
+inline std::vector<int> TimeVariable::get_time_values(const int t) const {
+    const auto& anchors = values;
+    auto result = std::vector<int>(anchors.size());
+    for (auto i = 0u; i < anchors.size(); ++i) {
+        result[i] = to_time(t, anchors[i]);
+    }
+    return result;
+}
+
+//' @title get the derived time at timestep t at index given by a bitset
+inline std::vector<int> TimeVariable::get_time_values(
+    const int t,
+    const individual_index_t& index
+) const {
+    auto result = get_values(index);
+    for (auto& x : result) {
+        x = to_time(t, x);
+    }
+    return result;
+}
+
+//' @title get the derived time at timestep t at index given by a vector
+inline std::vector<int> TimeVariable::get_time_values(
+    const int t,
+    const std::vector<size_t>& index
+) const {
+    auto result = get_values(index);
+    for (auto& x : result) {
+        x = to_time(t, x);
+    }
+    return result;
+}
+
+//' @title return bitset giving index of individuals whose time at timestep t is in a finite set
+inline individual_index_t TimeVariable::get_index_of_time_set(
+    const int t,
+    const std::vector<int>& times
+) const {
+    auto anchors = std::vector<int>(times.size());
+    for (auto i = 0u; i < times.size(); ++i) {
+        anchors[i] = to_anchor(t, times[i]);
+    }
+    return get_index_of_set(anchors);
+}
+
+//' @title return bitset giving index of individuals whose time at timestep t is in some range [a,b]
+//' @description the range is rewritten as a range over anchors, so no derived
+//' values are materialised
+inline individual_index_t TimeVariable::get_index_of_time_range(
+    const int t,
+    const int a,
+    const int b
+) const {
+    if (direction == time_direction::since) {
+        return get_index_of_range(to_anchor(t, b), to_anchor(t, a));
+    }
+    return get_index_of_range(to_anchor(t, a), to_anchor(t, b));
+}
+
+//' @title return number of individuals whose time at timestep t is in a finite set
+inline size_t TimeVariable::get_size_of_time_set(
+    const int t,
+    const std::vector<int>& times
+) const {
+    auto anchors = std::vector<int>(times.size());
+    for (auto i = 0u; i < times.size(); ++i) {
+        anchors[i] = to_anchor(t, times[i]);
+    }
+    return get_size_of_set(anchors);
+}
+
+//' @title return number of individuals whose time at timestep t is in some range [a,b]
+inline size_t TimeVariable::get_size_of_time_range(
+    const int t,
+    const int a,
+    const int b
+) const {
+    if (direction == time_direction::since) {
+        return get_size_of_range(to_anchor(t, b), to_anchor(t, a));
+    }
+    return get_size_of_range(to_anchor(t, a), to_anchor(t, b));
+}
+
+#endif /* INST_INCLUDE_TIME_VARIABLE_H_ */
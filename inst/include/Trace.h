@@ -0,0 +1,306 @@
+/*
+ * Trace.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_TRACE_H_
+#define INST_INCLUDE_TRACE_H_
+
+#include "Error.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+using trace_clock_t = std::chrono::steady_clock;
+
+//' @title a slice of time spent in one phase or operation
+//' @description name and category must outlive the recorder, so they are
+//' either literals or interned by the recorder. Times are in nanoseconds
+//' since the recorder was created, and timestep is negative if the slice
+//' does not belong to a timestep.
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    int64_t start;
+    int64_t duration;
+    int64_t timestep;
+};
+
+class TraceBuffer;
+class TraceRecorder;
+
+//' @title a ring buffer of the slices recorded on one thread
+//' @description Only its own thread pushes to a buffer, so pushing takes no
+//' lock. Once the buffer is full the oldest slices are overwritten. The
+//' slices should only be read once the threads have stopped recording.
+//' It contains the following data members:
+//'     * events: the ring of slices
+//'     * written: the number of slices ever pushed
+//'     * thread: the id of the buffer's thread in the trace
+class TraceBuffer {
+    std::vector<TraceEvent> events;
+    std::atomic<size_t> written;
+    size_t thread;
+
+public:
+    TraceBuffer(const size_t capacity, const size_t thread);
+
+    virtual ~TraceBuffer() = default;
+
+    virtual void push(const TraceEvent&);
+    virtual std::vector<TraceEvent> get_events() const;
+    virtual size_t get_thread() const;
+    virtual size_t dropped() const;
+};
+
+inline TraceBuffer::TraceBuffer(const size_t capacity, const size_t thread)
+    : events(capacity == 0 ? 1 : capacity), written(0), thread(thread) {}
+
+inline void TraceBuffer::push(const TraceEvent& event) {
+    const auto n = written.load(std::memory_order_relaxed);
+    events[n % events.size()] = event;
+    written.store(n + 1, std::memory_order_release);
+}
+
+//' @title the slices left in the buffer, oldest first
+inline std::vector<TraceEvent> TraceBuffer::get_events() const {
+    const auto n = written.load(std::memory_order_acquire);
+    const auto first = n > events.size() ? n - events.size() : 0;
+    auto result = std::vector<TraceEvent>();
+    result.reserve(n - first);
+    for (auto i = first; i < n; ++i) {
+        result.push_back(events[i % events.size()]);
+    }
+    return result;
+}
+
+inline size_t TraceBuffer::get_thread() const {
+    return thread;
+}
+
+//' @title the number of slices overwritten because the buffer was full
+inline size_t TraceBuffer::dropped() const {
+    const auto n = written.load(std::memory_order_acquire);
+    return n > events.size() ? n - events.size() : 0;
+}
+
+//' @title records slices of time on every thread, to view as a timeline
+//' @description Each thread records into its own TraceBuffer, which it
+//' registers the first time it records, so only registration and interning
+//' names take a lock. The trace is written in the Chrome trace event format,
+//' which Perfetto (https://ui.perfetto.dev) and chrome://tracing can open.
+//' It should only be written once the threads have stopped recording.
+//' It contains the following data members:
+//'     * id: a number unique to this recorder, so that threads can tell it
+//'       apart from earlier recorders at the same address
+//'     * capacity: the number of slices each thread's buffer keeps
+//'     * origin: the time the recorder was created
+//'     * buffers: the buffer of each thread that has recorded
+//'     * names: the interned names
+//'     * mutex: guards buffers and names
+class TraceRecorder {
+    uint64_t id;
+    size_t capacity;
+    trace_clock_t::time_point origin;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    std::set<std::string> names;
+    std::mutex mutex;
+
+    TraceBuffer& thread_buffer();
+
+public:
+    TraceRecorder(const size_t capacity = 1 << 16);
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    virtual ~TraceRecorder() = default;
+
+    virtual const char* intern(const std::string&);
+    virtual void record(
+        const char* name,
+        const char* category,
+        const trace_clock_t::time_point start,
+        const trace_clock_t::time_point end,
+        const int64_t timestep = -1
+    );
+    virtual size_t size();
+    virtual void write(std::ostream&);
+    virtual void write(const std::string& path);
+};
+
+//' @title the recorder that traced code records into, if any
+//' @description this is null unless a trace is being recorded, and should
+//' only be changed while no simulation is running
+inline std::atomic<TraceRecorder*>& trace_recorder() {
+    static std::atomic<TraceRecorder*> recorder(nullptr);
+    return recorder;
+}
+
+//' @title record the lifetime of a scope, if a trace is being recorded
+//' @description when nothing is being traced this costs one load and one
+//' branch, so it can be left in hot paths
+class TraceScope {
+    TraceRecorder* recorder;
+    const char* name;
+    const char* category;
+    trace_clock_t::time_point start;
+
+public:
+    TraceScope(const char* name, const char* category)
+        : recorder(trace_recorder().load(std::memory_order_relaxed)),
+          name(name),
+          category(category) {
+        if (recorder != nullptr) {
+            start = trace_clock_t::now();
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (recorder != nullptr) {
+            recorder->record(name, category, start, trace_clock_t::now());
+        }
+    }
+};
+
+//' @title wrap a task so that it is traced on the thread which runs it
+//' @description the task is returned as it is when nothing is being traced
+inline std::function<void ()> traced_task(
+    const std::function<void ()>& task,
+    const char* name,
+    const char* category
+) {
+    if (trace_recorder().load(std::memory_order_relaxed) == nullptr) {
+        return task;
+    }
+    return [task, name, category]() {
+        TraceScope trace(name, category);
+        task();
+    };
+}
+
+inline TraceRecorder::TraceRecorder(const size_t capacity)
+    : capacity(capacity), origin(trace_clock_t::now()) {
+    static std::atomic<uint64_t> next_id(1);
+    id = next_id++;
+}
+
+//' @title the buffer of the calling thread, registering it if it is new
+inline TraceBuffer& TraceRecorder::thread_buffer() {
+    struct cache_t {
+        uint64_t id = 0;
+        TraceBuffer* buffer = nullptr;
+    };
+    static thread_local cache_t cache;
+    if (cache.id != id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.emplace_back(new TraceBuffer(capacity, buffers.size()));
+        cache.id = id;
+        cache.buffer = buffers.back().get();
+    }
+    return *cache.buffer;
+}
+
+//' @title a copy of name which lives as long as the recorder
+inline const char* TraceRecorder::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.insert(name).first->c_str();
+}
+
+inline void TraceRecorder::record(
+    const char* name,
+    const char* category,
+    const trace_clock_t::time_point start,
+    const trace_clock_t::time_point end,
+    const int64_t timestep
+) {
+    thread_buffer().push({
+        name,
+        category,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+        timestep
+    });
+}
+
+//' @title the number of slices kept over every thread
+inline size_t TraceRecorder::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto n = size_t(0);
+    for (const auto& buffer : buffers) {
+        n += buffer->get_events().size();
+    }
+    return n;
+}
+
+//' @title write a string as a json string
+inline void write_json_string(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s != '\0'; ++s) {
+        const auto c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\') {
+            out << '\\' << *s;
+        } else if (c < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+            out << *s;
+        }
+    }
+    out << '"';
+}
+
+//' @title write the trace as Chrome trace event json
+//' @description each slice is a complete ("X") event on its thread's track,
+//' with times in microseconds. The number of slices dropped from full
+//' buffers is given under otherData.
+inline void TraceRecorder::write(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto dropped = size_t(0);
+    auto first = true;
+    out << "{\"traceEvents\":[\n" << std::fixed << std::setprecision(3);
+    for (const auto& buffer : buffers) {
+        const auto thread = buffer->get_thread();
+        dropped += buffer->dropped();
+        out << (first ? "" : ",\n")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+            << ",\"args\":{\"name\":\"thread " << thread << "\"}}";
+        first = false;
+        for (const auto& event : buffer->get_events()) {
+            out << ",\n{\"name\":";
+            write_json_string(out, event.name);
+            out << ",\"cat\":";
+            write_json_string(out, event.category);
+            out << ",\"ph\":\"X\",\"ts\":" << event.start / 1e3
+                << ",\"dur\":" << event.duration / 1e3
+                << ",\"pid\":1,\"tid\":" << thread;
+            if (event.timestep >= 0) {
+                out << ",\"args\":{\"timestep\":" << event.timestep << "}";
+            }
+            out << "}";
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":"
+        << dropped << "}}\n";
+}
+
+inline void TraceRecorder::write(const std::string& path) {
+    auto out = std::ofstream(path);
+    if (!out) {
+        raise_error("could not write the trace to " + path);
+    }
+    write(out);
+}
+
+#endif /* INST_INCLUDE_TRACE_H_ */
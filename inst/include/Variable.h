@@ -7,13 +7,87 @@
 #ifndef INST_INCLUDE_VARIABLE_H_
 #define INST_INCLUDE_VARIABLE_H_
 
+#include "ResizePlan.h"
+#include "Deferred.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+#include "memory_usage.h"
 #include <cstddef>
+#include <iterator>
+#include <vector>
 
+//' @title the interface for all variables
+//' @description version counts the changes made to the variable: it is
+//' incremented whenever update() or resize() changes the variable, so that
+//' results derived from it can tell whether they are still valid.
+//' A variable registered with a ResizeCoordinator is coordinated: resize()
+//' does nothing, and the coordinator resizes it with a plan shared by every
+//' object in the population.
+//' update_tasks splits an update into tasks which can be run in parallel with
+//' each other and with the tasks of other variables. By default the whole
+//' update is one task.
+//' resize(plan) applies a coordinator's plan; by default it falls back to
+//' resize(), and a variable without its own shrink queue reports an empty
+//' shrink index.
+//' tombstone removes individuals who have died from the variable's category
+//' bitsets and indices without renumbering anyone, so that queries stop
+//' finding them. Their values are kept. By default it does nothing.
+//' memory_usage estimates the bytes the variable holds, split into its
+//' values, its queued updates and its queued resizes; nothing by default.
 struct Variable {
     virtual void update() = 0;
+    virtual std::vector<task_t> update_tasks(const size_t /* chunks */) {
+        return { [this]() { update(); } };
+    }
     virtual void resize() = 0;
+    virtual void resize(const ResizePlan&) { resize(); }
+    virtual const individual_index_t& get_shrink_index() const {
+        static const auto empty = individual_index_t(0);
+        return empty;
+    }
+    virtual void tombstone(const individual_index_t&) {}
     virtual size_t size() const = 0;
+    virtual memory_usage_t memory_usage() const { return {}; }
+    virtual size_t get_version() const { return version; }
+    virtual void set_coordinated() { coordinated = true; }
     virtual ~Variable() = default;
+
+protected:
+    size_t version = 0;
+    bool coordinated = false;
 };
 
+//' @title update a batch of variables on a thread pool
+//' @description the updates of large variables are split into as many tasks
+//' as the pool has threads, and every task is run as one batch
+inline void update_variables(
+    const std::vector<Variable*>& variables,
+    ThreadPool& pool
+) {
+    auto tasks = std::vector<task_t>();
+    for (auto variable : variables) {
+        for (const auto& task : variable->update_tasks(pool.size())) {
+            tasks.push_back(traced_task(task, "variable_update", "update"));
+        }
+    }
+    pool.run(tasks);
+}
+
+//' @title resize a batch of variables on a thread pool, one task per variable
+inline void resize_variables(
+    const std::vector<Variable*>& variables,
+    ThreadPool& pool
+) {
+    auto tasks = std::vector<task_t>();
+    tasks.reserve(variables.size());
+    for (auto variable : variables) {
+        tasks.push_back(traced_task(
+            [variable]() { variable->resize(); },
+            "variable_resize",
+            "resize"
+        ));
+    }
+    pool.run(tasks);
+}
+
 #endif /* INST_INCLUDE_VARIABLE_H_ */
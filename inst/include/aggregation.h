@@ -0,0 +1,178 @@
+/*
+ * aggregation.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_AGGREGATION_H_
+#define INST_INCLUDE_AGGREGATION_H_
+
+#include "common_types.h"
+#include "Error.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+//' @title summary statistics of a set of values
+//' @description accumulated in one pass. The variance is the sample variance,
+//' computed with Welford's algorithm. With no values the mean and variance
+//' are NaN, the minimum is Inf and the maximum is -Inf; with one value the
+//' variance is NaN.
+struct numeric_summary_t {
+    size_t n = 0;
+    double sum = 0;
+    double mean = std::numeric_limits<double>::quiet_NaN();
+    double variance = std::numeric_limits<double>::quiet_NaN();
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    void add(const double x);
+
+private:
+    double running_mean = 0;
+    double m2 = 0;
+};
+
+inline void numeric_summary_t::add(const double x) {
+    ++n;
+    sum += x;
+    const auto delta = x - running_mean;
+    running_mean += delta / n;
+    m2 += delta * (x - running_mean);
+    mean = running_mean;
+    if (n > 1) {
+        variance = m2 / (n - 1);
+    }
+    min = std::min(min, x);
+    max = std::max(max, x);
+}
+
+//' @title call f(values[i]) for every individual, or for those in an index
+template<class S, class F>
+inline void for_each_value(
+    const std::vector<S>& values,
+    const individual_index_t* index,
+    F&& f
+) {
+    if (index == nullptr) {
+        for (const auto& v : values) {
+            f(v);
+        }
+        return;
+    }
+    if (index->max_size() != values.size()) {
+        raise_error("incompatible size bitset used to aggregate values");
+    }
+    bitset_for_each(*index, [&](const size_t i) { f(values[i]); });
+}
+
+//' @title summarise values, optionally restricted to an index
+template<class S>
+inline numeric_summary_t summarise_values(
+    const std::vector<S>& values,
+    const individual_index_t* index
+) {
+    auto summary = numeric_summary_t();
+    for_each_value(values, index, [&](const S v) {
+        summary.add(static_cast<double>(v));
+    });
+    return summary;
+}
+
+//' @title count values in bins, optionally restricted to an index
+//' @description bin k holds values in [breaks[k], breaks[k + 1]), except the
+//' last bin which also holds values equal to the last break. Values outside
+//' the breaks are not counted.
+//' @param breaks strictly increasing bin edges
+template<class S>
+inline std::vector<size_t> histogram_values(
+    const std::vector<S>& values,
+    const std::vector<double>& breaks,
+    const individual_index_t* index
+) {
+    if (breaks.size() < 2) {
+        raise_error("a histogram needs at least two breaks");
+    }
+    for (auto k = 1u; k < breaks.size(); ++k) {
+        if (!(breaks[k - 1] < breaks[k])) {
+            raise_error("histogram breaks must be strictly increasing");
+        }
+    }
+    auto counts = std::vector<size_t>(breaks.size() - 1);
+    const auto lower = breaks.front();
+    const auto upper = breaks.back();
+    for_each_value(values, index, [&](const S v) {
+        const auto x = static_cast<double>(v);
+        if (!(lower <= x && x <= upper)) {
+            return;
+        }
+        if (x == upper) {
+            ++counts.back();
+            return;
+        }
+        const auto bin = std::upper_bound(breaks.cbegin(), breaks.cend(), x);
+        ++counts[bin - breaks.cbegin() - 1];
+    });
+    return counts;
+}
+
+//' @title quantiles of values, optionally restricted to an index
+//' @description uses the same interpolation as R's default (type 7) quantile.
+//' The values are copied into a scratch buffer which is partially ordered
+//' with nth_element, visiting the probabilities in increasing order so that
+//' each selection only searches above the last. NaN values are dropped, and
+//' with no values every quantile is NaN.
+//' @param probs probabilities in [0, 1]
+template<class S>
+inline std::vector<double> quantile_values(
+    const std::vector<S>& values,
+    const std::vector<double>& probs,
+    const individual_index_t* index
+) {
+    for (const auto p : probs) {
+        if (!(p >= 0 && p <= 1)) {
+            raise_error("quantile probabilities must be in [0, 1]");
+        }
+    }
+    auto buffer = std::vector<double>();
+    buffer.reserve(index == nullptr ? values.size() : index->size());
+    for_each_value(values, index, [&](const S v) {
+        const auto x = static_cast<double>(v);
+        if (!std::isnan(x)) {
+            buffer.push_back(x);
+        }
+    });
+
+    auto result = std::vector<double>(
+        probs.size(),
+        std::numeric_limits<double>::quiet_NaN()
+    );
+    if (buffer.empty()) {
+        return result;
+    }
+
+    auto order = std::vector<size_t>(probs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+        return probs[a] < probs[b];
+    });
+
+    auto start = buffer.begin();
+    for (const auto k : order) {
+        const auto h = (buffer.size() - 1) * probs[k];
+        const auto lo = static_cast<size_t>(std::floor(h));
+        const auto nth = buffer.begin() + lo;
+        std::nth_element(start, nth, buffer.end());
+        start = nth;
+        auto x = *nth;
+        if (h > lo) {
+            const auto next = *std::min_element(nth + 1, buffer.end());
+            x += (h - lo) * (next - x);
+        }
+        result[k] = x;
+    }
+    return result;
+}
+
+#endif /* INST_INCLUDE_AGGREGATION_H_ */
@@ -0,0 +1,164 @@
+/*
+ * crosstab.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef INST_INCLUDE_CROSSTAB_H_
+#define INST_INCLUDE_CROSSTAB_H_
+
+#include "CategoricalVariable.h"
+#include "IntegerVariable.h"
+#include "Error.h"
+#include <algorithm>
+#include <limits>
+
+//' @title check the sizes of the inputs to a cross-tabulation
+inline void crosstab_check_sizes(
+    const size_t size_a,
+    const size_t size_b,
+    const individual_index_t* index
+) {
+    if (size_a != size_b) {
+        raise_error("variables used in a crosstab must be the same size");
+    }
+    if (index != nullptr && index->max_size() != size_a) {
+        raise_error("incompatible size bitset used to restrict a crosstab");
+    }
+}
+
+//' @title count individuals in each pair of categories of two CategoricalVariables
+//' @description each cell is the popcount of the intersection of two category
+//' bitsets (and the index, if given), computed word by word without building
+//' the intersection.
+//' @return counts in column-major order, with a row for each category of a
+//' and a column for each category of b
+inline std::vector<size_t> crosstab_categorical(
+    const CategoricalVariable& a,
+    const CategoricalVariable& b,
+    const individual_index_t* index
+) {
+    crosstab_check_sizes(a.size(), b.size(), index);
+    const auto& rows = a.get_categories();
+    const auto& cols = b.get_categories();
+    auto counts = std::vector<size_t>(rows.size() * cols.size());
+    for (auto j = 0u; j < cols.size(); ++j) {
+        const auto& col = b.get_index_ref(cols[j]);
+        for (auto i = 0u; i < rows.size(); ++i) {
+            const auto& row = a.get_index_ref(rows[i]);
+            auto count = size_t(0);
+            for (auto w = 0u; w < row.n_words(); ++w) {
+                auto word = row.word(w) & col.word(w);
+                if (index != nullptr) {
+                    word &= index->word(w);
+                }
+                count += popcount(word);
+            }
+            counts[i + j * rows.size()] = count;
+        }
+    }
+    return counts;
+}
+
+//' @title map integer values to the columns of a crosstab
+//' @description levels which span a small range are looked up in a dense
+//' table of codes, otherwise by binary search of the sorted levels. Values
+//' which are not levels map to npos.
+class level_codes_t {
+    std::vector<int> sorted;
+    std::vector<size_t> order;
+    std::vector<size_t> dense;
+    int lowest = 0;
+
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    level_codes_t(const std::vector<int>& levels);
+    size_t operator()(const int value) const;
+};
+
+inline level_codes_t::level_codes_t(const std::vector<int>& levels) {
+    if (levels.empty()) {
+        return;
+    }
+    order = std::vector<size_t>(levels.size());
+    for (auto i = 0u; i < levels.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](const size_t x, const size_t y) {
+        return levels[x] < levels[y];
+    });
+    sorted = std::vector<int>(levels.size());
+    for (auto i = 0u; i < levels.size(); ++i) {
+        sorted[i] = levels[order[i]];
+    }
+    if (std::adjacent_find(sorted.cbegin(), sorted.cend()) != sorted.cend()) {
+        raise_error("crosstab levels must be unique");
+    }
+    lowest = sorted.front();
+    const auto span = static_cast<double>(sorted.back()) - lowest + 1;
+    if (span <= 4. * levels.size() + 1024) {
+        dense = std::vector<size_t>(static_cast<size_t>(span), size_t(npos));
+        for (auto i = 0u; i < levels.size(); ++i) {
+            dense[static_cast<size_t>(static_cast<double>(levels[i]) - lowest)] = i;
+        }
+    }
+}
+
+inline size_t level_codes_t::operator()(const int value) const {
+    if (sorted.empty() || value < lowest || value > sorted.back()) {
+        return npos;
+    }
+    if (!dense.empty()) {
+        return dense[static_cast<size_t>(static_cast<double>(value) - lowest)];
+    }
+    const auto it = std::lower_bound(sorted.cbegin(), sorted.cend(), value);
+    if (*it != value) {
+        return npos;
+    }
+    return order[it - sorted.cbegin()];
+}
+
+//' @title count individuals in each pair of a category and an integer value
+//' @description each category's bitset (and the index, if given) is visited
+//' word by word, and the integer value of each member is mapped to a column
+//' with level_codes_t. Individuals whose value is not one of the levels are
+//' not counted. The values are read a word at a time, so compact variables
+//' are not widened as a whole.
+//' @return counts in column-major order, with a row for each category of a
+//' and a column for each of the levels
+inline std::vector<size_t> crosstab_categorical_integer(
+    const CategoricalVariable& a,
+    const IntegerVariable& b,
+    const std::vector<int>& levels,
+    const individual_index_t* index
+) {
+    crosstab_check_sizes(a.size(), b.size(), index);
+    const auto& rows = a.get_categories();
+    const auto codes = level_codes_t(levels);
+    auto counts = std::vector<size_t>(rows.size() * levels.size());
+    for (auto i = 0u; i < rows.size(); ++i) {
+        const auto& row = a.get_index_ref(rows[i]);
+        int buffer[64];
+        for (auto w = 0u; w < row.n_words(); ++w) {
+            auto word = row.word(w);
+            if (index != nullptr) {
+                word &= index->word(w);
+            }
+            if (word == 0) {
+                continue;
+            }
+            const auto values = b.get_word_values(w, buffer);
+            while (word != 0) {
+                const auto code = codes(values[ctz(word)]);
+                if (code != level_codes_t::npos) {
+                    ++counts[i + code * rows.size()];
+                }
+                word &= word - 1;
+            }
+        }
+    }
+    return counts;
+}
+
+#endif /* INST_INCLUDE_CROSSTAB_H_ */
@@ -9,12 +9,21 @@
 #define INDIVIDUAL_TYPES_H_
 
 #include <Rcpp.h>
+#include "RRandom.h"
 #include "CategoricalVariable.h"
 #include "IntegerVariable.h"
 #include "DoubleVariable.h"
+#include "CompactVariable.h"
+#include "TimeVariable.h"
 #include "RaggedInteger.h"
 #include "RaggedDouble.h"
+#include "FlatRaggedVariable.h"
 #include "Event.h"
 #include "RenderVector.h"
+#include "Query.h"
+#include "Population.h"
+#include "ResizeCoordinator.h"
+#include "Profiler.h"
+#include "memory_usage.h"
 
 #endif /* INDIVIDUAL_TYPES_H_ */
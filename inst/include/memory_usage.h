@@ -0,0 +1,223 @@
+/*
+ * memory_usage.h
+ *
+ *  Created on: 18 Oct 2026
+ *
+ *  Functions to estimate the memory held by variables, events and bitsets
+ */
+
+#ifndef INST_INCLUDE_MEMORY_USAGE_H_
+#define INST_INCLUDE_MEMORY_USAGE_H_
+
+#include <cstddef>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+//' @title the bytes of memory held by an object, by what they are held for
+//' @description
+//'     * storage: the object's current state, including any indices and
+//'       cached query results derived from it
+//'     * updates: queued updates, and the buffers kept to reuse for the next
+//'       timestep's updates
+//'     * resizes: queued shrinks and extensions
+//' Bytes are counted from the capacities of containers, so they include
+//' memory which has been reserved but not yet used. The nodes of maps and sets
+//' are estimated, and allocator overheads are not counted.
+struct memory_usage_t {
+    size_t storage = 0;
+    size_t updates = 0;
+    size_t resizes = 0;
+
+    memory_usage_t& operator+=(const memory_usage_t& other) {
+        storage += other.storage;
+        updates += other.updates;
+        resizes += other.resizes;
+        return *this;
+    }
+
+    size_t total() const {
+        return storage + updates + resizes;
+    }
+};
+
+//' @title the bytes of a map or set node besides its value, in the common
+//' implementations (a colour and three pointers)
+const size_t tree_node_bytes = 4 * sizeof(void*);
+
+//' @title the heap memory held by a value, besides its own size
+//' @description values stored in place, such as numbers, hold none. The
+//' overloads are all declared before they are defined, so that containers of
+//' containers find them.
+template<class A>
+inline size_t heap_bytes(const A&);
+inline size_t heap_bytes(const std::string&);
+template<class A>
+inline size_t heap_bytes(const std::vector<A>&);
+template<class A>
+inline size_t heap_bytes(const std::set<A>&);
+template<class K, class V>
+inline size_t heap_bytes(const std::map<K, V>&);
+template<class K, class V>
+inline size_t heap_bytes(const std::unordered_map<K, V>&);
+template<class A, class Container>
+inline size_t heap_bytes(const std::queue<A, Container>&);
+template<class A, class B>
+inline size_t heap_bytes(const std::pair<A, B>&);
+
+template<class A>
+inline size_t heap_bytes(const A&) {
+    return 0;
+}
+
+//' @title the heap memory held by a string
+//' @description short strings are stored in place, up to the capacity of an
+//' empty string
+inline size_t heap_bytes(const std::string& s) {
+    static const auto small = std::string().capacity();
+    return s.capacity() > small ? s.capacity() + 1 : 0;
+}
+
+//' @title the heap memory held by a vector
+//' @description vectors of numbers hold none besides their buffer, which
+//' saves visiting every value of large numeric vectors
+template<class A>
+inline size_t heap_bytes(const std::vector<A>& v) {
+    auto bytes = v.capacity() * sizeof(A);
+    if (std::is_arithmetic<A>::value) {
+        return bytes;
+    }
+    for (const auto& x : v) {
+        bytes += heap_bytes(x);
+    }
+    return bytes;
+}
+
+template<class A>
+inline size_t heap_bytes(const std::set<A>& s) {
+    auto bytes = s.size() * (sizeof(A) + tree_node_bytes);
+    for (const auto& x : s) {
+        bytes += heap_bytes(x);
+    }
+    return bytes;
+}
+
+template<class K, class V>
+inline size_t heap_bytes(const std::map<K, V>& m) {
+    auto bytes = m.size() * (sizeof(std::pair<const K, V>) + tree_node_bytes);
+    for (const auto& x : m) {
+        bytes += heap_bytes(x.first) + heap_bytes(x.second);
+    }
+    return bytes;
+}
+
+template<class K, class V>
+inline size_t heap_bytes(const std::unordered_map<K, V>& m) {
+    // each node holds its value, a next pointer and a cached hash
+    auto bytes = m.bucket_count() * sizeof(void*) +
+        m.size() * (sizeof(std::pair<const K, V>) + 2 * sizeof(void*));
+    for (const auto& x : m) {
+        bytes += heap_bytes(x.first) + heap_bytes(x.second);
+    }
+    return bytes;
+}
+
+//' @title the heap memory held by a queue
+//' @description a queue does not expose its elements, so they are read
+//' through its protected container
+template<class A, class Container>
+inline size_t heap_bytes(const std::queue<A, Container>& q) {
+    struct access : std::queue<A, Container> {
+        static const Container& container(const std::queue<A, Container>& q) {
+            return q.*(&access::c);
+        }
+    };
+    auto bytes = q.size() * sizeof(A);
+    for (const auto& x : access::container(q)) {
+        bytes += heap_bytes(x);
+    }
+    return bytes;
+}
+
+template<class A, class B>
+inline size_t heap_bytes(const std::pair<A, B>& p) {
+    return heap_bytes(p.first) + heap_bytes(p.second);
+}
+
+//' @title records the memory held by each variable and event of a simulation
+//' @description Objects are identified by their kind ("variable" or "event")
+//' and name, and a row is recorded for each object on each reported timestep.
+//' It contains the following data members:
+//'     * every: the number of timesteps between reports
+//'     * timesteps, kinds, names: the timestep and object of each row
+//'     * usages: the memory held by the object of each row
+class MemoryReport {
+    size_t every;
+    std::vector<size_t> timesteps;
+    std::vector<std::string> kinds;
+    std::vector<std::string> names;
+    std::vector<memory_usage_t> usages;
+
+public:
+    MemoryReport(const size_t every = 1);
+    virtual ~MemoryReport() = default;
+
+    virtual bool should_report(const size_t timestep) const;
+    virtual void record(
+        const size_t timestep,
+        const std::string& kind,
+        const std::string& name,
+        const memory_usage_t& usage
+    );
+    virtual size_t size() const;
+    virtual const std::vector<size_t>& get_timesteps() const;
+    virtual const std::vector<std::string>& get_kinds() const;
+    virtual const std::vector<std::string>& get_names() const;
+    virtual const std::vector<memory_usage_t>& get_usages() const;
+};
+
+inline MemoryReport::MemoryReport(const size_t every)
+    : every(every == 0 ? 1 : every) {}
+
+//' @title whether to report on a timestep, every `every` timesteps
+inline bool MemoryReport::should_report(const size_t timestep) const {
+    return timestep % every == 0;
+}
+
+inline void MemoryReport::record(
+    const size_t timestep,
+    const std::string& kind,
+    const std::string& name,
+    const memory_usage_t& usage
+) {
+    timesteps.push_back(timestep);
+    kinds.push_back(kind);
+    names.push_back(name);
+    usages.push_back(usage);
+}
+
+inline size_t MemoryReport::size() const {
+    return usages.size();
+}
+
+inline const std::vector<size_t>& MemoryReport::get_timesteps() const {
+    return timesteps;
+}
+
+inline const std::vector<std::string>& MemoryReport::get_kinds() const {
+    return kinds;
+}
+
+inline const std::vector<std::string>& MemoryReport::get_names() const {
+    return names;
+}
+
+inline const std::vector<memory_usage_t>& MemoryReport::get_usages() const {
+    return usages;
+}
+
+#endif /* INST_INCLUDE_MEMORY_USAGE_H_ */
@@ -0,0 +1,231 @@
+/*
+ * prefab.h
+ *
+ *  Created on: 18 Oct 2026
+ *
+ *  Prefab processes, which the R package wraps in external pointers
+ */
+
+#ifndef INST_INCLUDE_PREFAB_H_
+#define INST_INCLUDE_PREFAB_H_
+
+#include "CategoricalVariable.h"
+#include "DoubleVariable.h"
+#include "IntegerVariable.h"
+#include "RenderVector.h"
+#include "crosstab.h"
+#include "common_types.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <vector>
+
+//' @title cumulative probabilities of the destinations of a multinomial
+inline std::vector<double> destination_cdf(const std::vector<double>& probabilities) {
+    std::vector<double> cdf(probabilities);
+    std::partial_sum(probabilities.begin(),probabilities.end(),cdf.begin(),std::plus<double>());
+    return cdf;
+}
+
+//' @title move individuals out of a category with a fixed probability, into
+//' destinations chosen with fixed probabilities
+//' @description the variables must outlive the process
+inline process_t fixed_probability_multinomial_process(
+    CategoricalVariable& state,
+    const std::string source_state,
+    const std::vector<std::string> destination_states,
+    const double rate,
+    const std::vector<double> destination_probabilities
+) {
+    const auto cdf = destination_cdf(destination_probabilities);
+    const auto variable = &state;
+    return [variable,source_state,destination_states,rate,cdf](size_t /* t */){
+        // sample leavers
+        individual_index_t leaving_individuals(variable->get_index_of(source_state));
+        bitset_sample_internal(leaving_individuals, rate);
+
+        // empty bitsets to put them (their destinations)
+        std::vector<individual_index_t> destination_individuals;
+        size_t n = destination_states.size();
+        for (size_t i=0; i<n; i++) {
+            destination_individuals.emplace_back(leaving_individuals.max_size());
+        }
+
+        // random variate for each leaver to see where they go
+        const auto random = random_uniforms(leaving_individuals.size());
+        auto random_index = 0;
+        for (auto it = std::begin(leaving_individuals); it != std::end(leaving_individuals); ++it) {
+            auto dest_it = std::upper_bound(cdf.begin(), cdf.end(), random[random_index]);
+            int dest = std::distance(cdf.begin(), dest_it);
+            destination_individuals[dest].insert(*it);
+            ++random_index;
+        }
+
+        // queue state updates
+        for (size_t i=0; i<n; i++) {
+            variable->queue_update(destination_states[i], destination_individuals[i]);
+        }
+    };
+}
+
+//' @title move individuals out of a category with their own probabilities,
+//' into destinations chosen with fixed probabilities
+//' @description the variables must outlive the process
+inline process_t multi_probability_multinomial_process(
+    CategoricalVariable& state,
+    const std::string source_state,
+    const std::vector<std::string> destination_states,
+    const DoubleVariable& rate,
+    const std::vector<double> destination_probabilities
+) {
+    const auto cdf = destination_cdf(destination_probabilities);
+    const auto variable = &state;
+    const auto rate_variable = &rate;
+    return [variable,source_state,destination_states,rate_variable,cdf](size_t /* t */){
+        // sample leavers with their unique prob
+        individual_index_t leaving_individuals(variable->get_index_of(source_state));
+        std::vector<double> rate_vector = rate_variable->get_values(leaving_individuals);
+        bitset_sample_multi_internal(leaving_individuals, rate_vector.begin(), rate_vector.end());
+
+        // empty bitsets to put them (their destinations)
+        std::vector<individual_index_t> destination_individuals;
+        size_t n = destination_states.size();
+        for (size_t i=0; i<n; i++) {
+            destination_individuals.emplace_back(leaving_individuals.max_size());
+        }
+
+        // random variate for each leaver to see where they go
+        const auto random = random_uniforms(leaving_individuals.size());
+        auto random_index = 0;
+        for (auto it = std::begin(leaving_individuals); it != std::end(leaving_individuals); ++it) {
+            auto dest_it = std::upper_bound(cdf.begin(), cdf.end(), random[random_index]);
+            int dest = std::distance(cdf.begin(), dest_it);
+            destination_individuals[dest].insert(*it);
+            ++random_index;
+        }
+
+        // queue state updates
+        for (size_t i=0; i<n; i++) {
+            variable->queue_update(destination_states[i], destination_individuals[i]);
+        }
+    };
+}
+
+//' @title move individuals between categories with their own probabilities
+//' @description the variables must outlive the process
+inline process_t multi_probability_bernoulli_process(
+    CategoricalVariable& state,
+    const std::string from,
+    const std::string to,
+    const DoubleVariable& rate
+) {
+    const auto variable = &state;
+    const auto rate_variable = &rate;
+    return [variable,rate_variable,from,to](size_t /* t */){
+        // sample leavers with their unique prob
+        individual_index_t leaving_individuals(variable->get_index_of(from));
+        std::vector<double> rate_vector = rate_variable->get_values(leaving_individuals);
+        bitset_sample_multi_internal(leaving_individuals, rate_vector.begin(), rate_vector.end());
+
+        variable->queue_update(to, leaving_individuals);
+    };
+}
+
+//' @title infect susceptible individuals with an age-structured force of
+//' infection
+//' @param mixing the age_bins by age_bins mixing matrix, column major, with
+//' n_rows rows. It is read in place, so it must outlive the process along with
+//' the variables.
+inline process_t infection_age_process(
+    CategoricalVariable& state_variable,
+    const std::string susceptible,
+    const std::string exposed,
+    const std::string infectious,
+    const IntegerVariable& age_variable,
+    const int age_bins,
+    const double p,
+    const double dt,
+    const double* mixing_values,
+    const size_t n_rows
+) {
+    const auto state = &state_variable;
+    const auto age = &age_variable;
+    return [state,age,age_bins,susceptible,exposed,infectious,p,dt,mixing_values,n_rows](size_t /* t */){
+        // data structures we need to compute the age-structured force of infection
+        std::vector<double> N(age_bins);
+        std::vector<double> I(age_bins);
+        std::vector<individual_index_t> S(age_bins, state->size());
+
+        // count infectious and total individuals in each age bin with one
+        // state by age crosstab
+        std::vector<int> ages(age_bins);
+        std::iota(ages.begin(), ages.end(), 1);
+        const auto& categories = state->get_categories();
+        const auto counts = crosstab_categorical_integer(*state, *age, ages, nullptr);
+        const auto infectious_row = std::find(
+            categories.cbegin(),
+            categories.cend(),
+            infectious
+        ) - categories.cbegin();
+        if (static_cast<size_t>(infectious_row) == categories.size()) {
+            raise_error("unknown category: " + infectious);
+        }
+        for (int a=0; a < age_bins; ++a) {
+            for (auto c = 0u; c < categories.size(); ++c) {
+                N[a] += counts[c + a * categories.size()];
+            }
+            I[a] = counts[infectious_row + a * categories.size()];
+        }
+
+        // split susceptible individuals by age bin in one pass, reading the
+        // ages a word at a time
+        const auto& susceptible_index = state->get_index_ref(susceptible);
+        int buffer[64];
+        for (auto w = 0u; w < susceptible_index.n_words(); ++w) {
+            auto word = susceptible_index.word(w);
+            if (word == 0) {
+                continue;
+            }
+            const auto age_values = age->get_word_values(w, buffer);
+            while (word != 0) {
+                const auto k = ctz(word);
+                const auto a = age_values[k];
+                if (a >= 1 && a <= age_bins) {
+                    S[a-1].insert(w * 64 + k);
+                }
+                word &= word - 1;
+            }
+        }
+
+        // compute foi and sample infection for susceptible individuals in each age bin
+        for (int a=1; a <= age_bins; ++a) {
+            double contacts = 0;
+            for (int b=0; b < age_bins; ++b) {
+                contacts += mixing_values[(a-1) + b * n_rows] * (I[b] / N[b]);
+            }
+            double foi = p * contacts;
+            // the exponential cdf, as in Rf_pexp(foi * dt, 1., 1, 0)
+            bitset_sample_internal(S[a-1], -std::expm1(-foi * dt));
+            state->queue_update(exposed, S[a-1]);
+        }
+    };
+}
+
+//' @title render the number of individuals in each category
+//' @param vectors the vector to render each category's count into
+//' @description the variable and render vectors must outlive the process
+inline process_t categorical_count_renderer_process(
+    const std::vector<RenderVector*> vectors,
+    const CategoricalVariable& state,
+    const std::vector<std::string> categories
+) {
+    const auto variable = &state;
+    return [variable,categories,vectors](size_t t){
+        for (auto i = 0u; i < categories.size(); ++i) {
+            vectors[i]->update(t, variable->get_size_of(categories[i]));
+        }
+    };
+}
+
+#endif /* INST_INCLUDE_PREFAB_H_ */
@@ -1,5 +1,7 @@
-#include <Rcpp.h>
+#include "Error.h"
 #include <iterator>
+#include <numeric>
+#include <vector>
 
 #ifndef UTILS_H_
 #define UTILS_H_
@@ -55,7 +57,7 @@ public:
             if (diff_i < diffs.size()) {
                 std::advance(it, diffs[diff_i]);
                 if (it == it_end) {
-                    Rcpp::stop("invalid index for filtering");
+                    raise_error("invalid index for filtering");
                 }
             }
         }
@@ -78,7 +80,7 @@ public:
             }
             std::advance(this->s_begin, *this->f_begin);
             if (this->s_begin == this->s_end) {
-                Rcpp::stop("invalid index for filtering");
+                raise_error("invalid index for filtering");
             }
         }
     }
@@ -11,46 +11,494 @@
 #define VECTOR_VARIABLES_H_
 
 #include "common_types.h"
-#include <queue>
+#include "ThreadPool.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+//' @title the fewest values updated by one task, a multiple of the word size
+const size_t min_update_range = 1 << 14;
+
+//' @title a planned queue of updates to a vector-based variable
+//' @description Updates are planned as they are queued rather than replayed
+//' verbatim:
+//'     * a full replacement or fill discards every update queued before it,
+//'       since they would all be overwritten
+//'     * consecutive fills to the same value are merged into one update
+//'     * dense index lists for fills are converted into bitset masks, so the
+//'       index vector is released when it is queued
+//'     * updates to a bitset target are stored as a bitset mask, unless the
+//'       target is sparse enough that an index list is smaller
+//' Besides assignments, the queue can hold modifications, which are applied to
+//' the current value of each member of a bitset in their place in the queue.
+//' Entries are kept after they are applied and reused by the next timestep's
+//' updates. Their masks, and the index lists copied from bitset targets, keep
+//' their buffers, while value and index vectors which are passed in are moved
+//' into the entry.
+template<class A>
+class VectorUpdateQueue {
+
+    struct planned_update_t {
+        std::vector<A> values;
+        std::vector<size_t> index;
+        individual_index_t mask = individual_index_t(0);
+        bool masked = false;
+        std::function<void(A&)> modify;
+        // positions in index, bucketed by the range they update
+        std::vector<std::vector<size_t>> ranges;
+    };
+
+    std::vector<planned_update_t> planned;
+    size_t n_planned = 0;
+
+    static bool is_dense(const size_t n, const size_t size);
+    static void reset_mask(planned_update_t&, const size_t size);
+    planned_update_t& next_entry();
+    template<class Setter>
+    static void apply_update(const planned_update_t&, const size_t size, Setter&& set);
+    static void bucket_index(planned_update_t&, const size_t step, const size_t n_ranges);
+    static void apply_range(
+        const planned_update_t&,
+        std::vector<A>& values,
+        const size_t begin,
+        const size_t end,
+        const size_t range
+    );
+
+public:
+    void push(std::vector<A> values, std::vector<size_t> index, const size_t size);
+    void push(std::vector<A> values, const individual_index_t& index);
+    void push_modify(std::function<void(A&)> modify, const individual_index_t& index);
+    void apply(std::vector<A>& values);
+    std::vector<task_t> apply_tasks(std::vector<A>& values, const size_t chunks);
+    template<class Setter, class Modifier>
+    void apply(const size_t size, Setter&& set, Modifier&& modify);
+    size_t size() const;
+    size_t memory_usage() const;
+};
+
+//' @title should a fill over n of size elements be stored as a bitset mask
+//' @description a mask costs a bit per element, an index list a word per
+//' updated element
+template<class A>
+inline bool VectorUpdateQueue<A>::is_dense(const size_t n, const size_t size) {
+    return n * 64 >= size;
+}
+
+//' @title get an unused entry, reusing one left over from a previous step
+template<class A>
+inline typename VectorUpdateQueue<A>::planned_update_t& VectorUpdateQueue<A>::next_entry() {
+    if (n_planned == planned.size()) {
+        planned.emplace_back();
+    }
+    auto& entry = planned[n_planned++];
+    entry.values.clear();
+    entry.index.clear();
+    entry.masked = false;
+    entry.modify = nullptr;
+    return entry;
+}
+
+//' @title clear an entry's bitset mask, reusing its buffer if possible
+template<class A>
+inline void VectorUpdateQueue<A>::reset_mask(
+    planned_update_t& entry,
+    const size_t size
+) {
+    if (entry.mask.max_size() == size) {
+        entry.mask.clear();
+    } else {
+        entry.mask = individual_index_t(size);
+    }
+    entry.masked = true;
+}
+
+//' @title queue an update
+//' @param values the new values, a single value is a fill
+//' @param index the indices to update, empty for a full replacement or fill
+//' @param size the size of the variable being updated
+template<class A>
+inline void VectorUpdateQueue<A>::push(
+    std::vector<A> values,
+    std::vector<size_t> index,
+    const size_t size
+) {
+    const auto vector_replacement = (index.size() == 0);
+    const auto value_fill = (values.size() == 1);
+
+    if (vector_replacement) {
+        // everything queued so far would be overwritten
+        n_planned = 0;
+    } else if (value_fill && n_planned > 0) {
+        auto& last = planned[n_planned - 1];
+        const auto last_fill = (last.masked || last.index.size() > 0) &&
+            last.values.size() == 1;
+        if (last_fill && last.values[0] == values[0]) {
+            // merge with the previous fill to the same value
+            if (last.masked) {
+                last.mask.insert(index.cbegin(), index.cend());
+            } else {
+                last.index.insert(last.index.cend(), index.cbegin(), index.cend());
+                if (is_dense(last.index.size(), size)) {
+                    reset_mask(last, size);
+                    last.mask.insert(last.index.cbegin(), last.index.cend());
+                    last.index.clear();
+                }
+            }
+            return;
+        }
+    }
+
+    auto& entry = next_entry();
+    entry.values = std::move(values);
+    if (value_fill && !vector_replacement && is_dense(index.size(), size)) {
+        reset_mask(entry, size);
+        entry.mask.insert(index.cbegin(), index.cend());
+    } else {
+        entry.index = std::move(index);
+    }
+}
+
+//' @title queue an update to a bitset target
+//' @description a single value fills the target, otherwise the k-th value is
+//' assigned to the k-th member of the target
+//' @param values the new values
+//' @param index the individuals to update, its max_size is the size of the
+//' variable
+template<class A>
+inline void VectorUpdateQueue<A>::push(
+    std::vector<A> values,
+    const individual_index_t& index
+) {
+    const auto size = index.max_size();
+    const auto value_fill = (values.size() == 1);
+    const auto dense = is_dense(index.size(), size);
+
+    if (value_fill && n_planned > 0) {
+        auto& last = planned[n_planned - 1];
+        const auto last_fill = (last.masked || last.index.size() > 0) &&
+            last.values.size() == 1;
+        if (last_fill && last.values[0] == values[0]) {
+            // merge with the previous fill to the same value
+            if (last.masked) {
+                last.mask |= index;
+            } else if (dense) {
+                reset_mask(last, size);
+                last.mask.insert(last.index.cbegin(), last.index.cend());
+                last.mask |= index;
+                last.index.clear();
+            } else {
+                last.index.insert(last.index.cend(), index.cbegin(), index.cend());
+            }
+            return;
+        }
+    }
+
+    auto& entry = next_entry();
+    entry.values = std::move(values);
+    if (dense) {
+        entry.mask = index;
+        entry.masked = true;
+    } else {
+        entry.index.assign(index.cbegin(), index.cend());
+    }
+}
+
+//' @title queue a modification of the values of some individuals
+//' @param modify a function which modifies a value in place
+//' @param index the individuals whose values are modified
+template<class A>
+inline void VectorUpdateQueue<A>::push_modify(
+    std::function<void(A&)> modify,
+    const individual_index_t& index
+) {
+    auto& entry = next_entry();
+    entry.modify = std::move(modify);
+    entry.mask = index;
+    entry.masked = true;
+}
+
+//' @title apply one planned update through a setter
+//' @param update the planned update
+//' @param size the size of the variable being updated
+//' @param set called as set(i, value) for every assignment
+template<class A>
+template<class Setter>
+inline void VectorUpdateQueue<A>::apply_update(
+    const planned_update_t& update,
+    const size_t size,
+    Setter&& set
+) {
+    const auto& new_values = update.values;
+    const auto& index = update.index;
+
+    auto vector_replacement = (!update.masked && index.size() == 0);
+    auto value_fill = (new_values.size() == 1);
+
+    if (vector_replacement) {
+        if (value_fill) {
+            // For a full vector fill
+            for (auto i = 0u; i < size; ++i) {
+                set(i, new_values[0]);
+            }
+        } else {
+            // For a full vector replacement
+            for (auto i = 0u; i < new_values.size(); ++i) {
+                set(i, new_values[i]);
+            }
+        }
+    } else if (update.masked) {
+        // For an update over a mask
+        auto k = 0u;
+        bitset_for_each(update.mask, [&](const size_t i) {
+            set(i, value_fill ? new_values[0] : new_values[k++]);
+        });
+    } else {
+        if (value_fill) {
+            // For a fill update
+            for (auto i : index) {
+                set(i, new_values[0]);
+            }
+        } else {
+            // Subset assignment
+            for (auto i = 0u; i < index.size(); ++i) {
+                set(index[i], new_values[i]);
+            }
+        }
+    }
+}
+
+//' @title apply all planned updates in FIFO order
+template<class A>
+inline void VectorUpdateQueue<A>::apply(std::vector<A>& values) {
+    for (auto u = 0u; u < n_planned; ++u) {
+        auto& update = planned[u];
+        if (update.modify) {
+            bitset_for_each(update.mask, [&](const size_t i) {
+                update.modify(values[i]);
+            });
+            continue;
+        }
+        if (!update.masked && update.index.empty() && update.values.size() != 1) {
+            // a full vector replacement can take the new values wholesale
+            values = std::move(update.values);
+            continue;
+        }
+        apply_update(update, values.size(), [&values](const size_t i, const A& value) {
+            values[i] = value;
+        });
+    }
+    n_planned = 0;
+}
+
+//' @title bucket the positions of an index list by the range they update
+//' @description positions keep their order within a bucket, so later
+//' assignments to the same individual still win
+//' @param step the length of each range
+//' @param n_ranges the number of ranges
+template<class A>
+inline void VectorUpdateQueue<A>::bucket_index(
+    planned_update_t& update,
+    const size_t step,
+    const size_t n_ranges
+) {
+    update.ranges.resize(n_ranges);
+    for (auto& bucket : update.ranges) {
+        bucket.clear();
+    }
+    for (auto k = 0u; k < update.index.size(); ++k) {
+        update.ranges[update.index[k] / step].push_back(k);
+    }
+}
+
+//' @title apply one planned update to the values in [begin, end)
+//' @description begin must be a multiple of the word size, so that the mask of
+//' an update can be read a word at a time. An index list must have been
+//' bucketed with bucket_index, range being the number of this range.
+template<class A>
+inline void VectorUpdateQueue<A>::apply_range(
+    const planned_update_t& update,
+    std::vector<A>& values,
+    const size_t begin,
+    const size_t end,
+    const size_t range
+) {
+    const auto& new_values = update.values;
+    const auto& index = update.index;
+    const auto value_fill = (new_values.size() == 1);
+    if (update.modify) {
+        bitset_for_each(update.mask, begin, end, [&](const size_t i) {
+            update.modify(values[i]);
+        });
+    } else if (!update.masked && index.empty()) {
+        if (value_fill) {
+            std::fill(values.begin() + begin, values.begin() + end, new_values[0]);
+        } else {
+            std::copy(
+                new_values.cbegin() + begin,
+                new_values.cbegin() + end,
+                values.begin() + begin
+            );
+        }
+    } else if (update.masked) {
+        auto k = size_t(0);
+        if (!value_fill) {
+            // the values before this range belong to the earlier members
+            const auto first = begin / (sizeof(uint64_t) * 8);
+            for (auto w = size_t(0); w < first; ++w) {
+                k += popcount(update.mask.word(w));
+            }
+        }
+        bitset_for_each(update.mask, begin, end, [&](const size_t i) {
+            values[i] = value_fill ? new_values[0] : new_values[k++];
+        });
+    } else {
+        for (const auto k : update.ranges[range]) {
+            values[index[k]] = value_fill ? new_values[0] : new_values[k];
+        }
+    }
+}
+
+//' @title split the planned updates into tasks over ranges of the values
+//' @description each task applies every planned update in FIFO order to its
+//' own range of the values, so the tasks can be run in parallel. A full
+//' replacement at the front of the queue is taken wholesale before the tasks
+//' are made. The queue is cleared, but the planned updates must not be queued
+//' over again until the tasks have finished.
+//' @param values the values to update
+//' @param chunks the number of ranges to split the values into. Ranges are
+//' never shorter than min_update_range, so small variables are one task.
+template<class A>
+inline std::vector<task_t> VectorUpdateQueue<A>::apply_tasks(
+    std::vector<A>& values,
+    const size_t chunks
+) {
+    auto first = size_t(0);
+    const auto last = n_planned;
+    n_planned = 0;
+    if (last > 0) {
+        auto& update = planned[0];
+        if (!update.modify && !update.masked && update.index.empty() &&
+            update.values.size() != 1) {
+            values = std::move(update.values);
+            first = 1;
+        }
+    }
+    auto tasks = std::vector<task_t>();
+    if (first == last) {
+        return tasks;
+    }
+    const auto bits = sizeof(uint64_t) * 8;
+    const auto words = (values.size() + bits - 1) / bits;
+    const auto step = std::max<size_t>(
+        (words + chunks - 1) / chunks * bits,
+        min_update_range
+    );
+    const auto n_ranges = (values.size() + step - 1) / step;
+    for (auto u = first; u < last; ++u) {
+        auto& update = planned[u];
+        if (!update.modify && !update.masked && !update.index.empty()) {
+            // bucket once, rather than scanning the whole list in every task
+            bucket_index(update, step, n_ranges);
+        }
+    }
+    for (auto range = size_t(0); range < n_ranges; ++range) {
+        const auto begin = range * step;
+        const auto end = std::min(begin + step, values.size());
+        tasks.push_back([this, &values, first, last, begin, end, range]() {
+            for (auto u = first; u < last; ++u) {
+                apply_range(planned[u], values, begin, end, range);
+            }
+        });
+    }
+    return tasks;
+}
+
+//' @title apply all planned updates in FIFO order through a setter
+//' @description for variables which do not store their values in a
+//' std::vector<A>
+//' @param size the size of the variable being updated
+//' @param set called as set(i, value) for every assignment
+//' @param modify called as modify(i, f) for every modification, where f
+//' modifies a value in place
+template<class A>
+template<class Setter, class Modifier>
+inline void VectorUpdateQueue<A>::apply(
+    const size_t size,
+    Setter&& set,
+    Modifier&& modify
+) {
+    for (auto u = 0u; u < n_planned; ++u) {
+        const auto& update = planned[u];
+        if (update.modify) {
+            bitset_for_each(update.mask, [&](const size_t i) {
+                modify(i, update.modify);
+            });
+        } else {
+            apply_update(update, size, set);
+        }
+    }
+    n_planned = 0;
+}
+
+//' @title the number of planned updates
+template<class A>
+inline size_t VectorUpdateQueue<A>::size() const {
+    return n_planned;
+}
+
+//' @title the bytes held by the queue, including the entries kept for reuse
+template<class A>
+inline size_t VectorUpdateQueue<A>::memory_usage() const {
+    auto bytes = planned.capacity() * sizeof(planned_update_t);
+    for (const auto& entry : planned) {
+        bytes += heap_bytes(entry.values) + heap_bytes(entry.index) +
+            heap_bytes(entry.ranges) + entry.mask.memory_usage();
+    }
+    return bytes;
+}
 
 //' @title Apply state updates to a vector-based variable
-//' @param updates queue of value/index pairs to apply in FIFO order
+//' @param updates queue of planned updates to apply in FIFO order
 //' @param values variable values to update
 template<class A>
 inline void vector_update(
-    std::queue<std::pair<std::vector<A>, std::vector<size_t>>>& updates,
+    VectorUpdateQueue<A>& updates,
     std::vector<A>& values
     ) {
-    while(updates.size() > 0) {
-        auto& update = updates.front();
-        auto& new_values = update.first;
-        auto& index = update.second;
-        
-        auto vector_replacement = (index.size() == 0);
-        auto value_fill = (new_values.size() == 1);
-        
-        if (vector_replacement) {
-            // For a full vector replacement
-            if (value_fill) {
-                std::fill(values.begin(), values.end(), new_values[0]);
-            } else {
-                values = std::move(new_values);
-            }
-        } else {
-            if (value_fill) {
-                // For a fill update
-                for (auto i : index) {
-                    values[i] = new_values[0];
-                }
-            } else {
-                // Subset assignment
-                for (auto i = 0u; i < index.size(); ++i) {
-                    values[index[i]] = new_values[i];
-                }
-            }
+    updates.apply(values);
+}
+
+//' @title Remove elements from a vector in place
+//' @description survivors keep their order. Each removed element ends a run
+//' of survivors which is moved down in one go, so words of the shrink index
+//' with no removals are skipped entirely.
+//' @param values the vector to shrink
+//' @param shrink_index index of elements to remove
+template<class A>
+inline void shrink_vector(
+    std::vector<A>& values,
+    const individual_index_t& shrink_index
+) {
+    if (shrink_index.empty()) {
+        return;
+    }
+    const auto word_bits = sizeof(shrink_index.word(0)) * 8;
+    auto next = values.begin();
+    auto run_start = values.begin();
+    for (auto w = 0u; w < shrink_index.n_words(); ++w) {
+        auto word = shrink_index.word(w);
+        while (word != 0) {
+            const auto removed = values.begin() + w * word_bits + ctz(word);
+            // survivors before the first removal are already in place
+            next = next == run_start ? removed : std::move(run_start, removed, next);
+            run_start = removed + 1;
+            word &= word - 1;
         }
-        updates.pop();
     }
+    next = std::move(run_start, values.end(), next);
+    values.erase(next, values.end());
 }
 
 //' @title Resize a vector-based variable
@@ -69,21 +517,7 @@ inline void resize_vector(
 
     // Apply shrink updates
     if (shrink_index.size() > 0) {
-        const auto index = std::vector<size_t>(
-            shrink_index.cbegin(),
-            shrink_index.cend()
-        );
-        auto new_values = std::vector<A>();
-        new_values.reserve(values.size() - index.size());
-        auto it = index.cbegin();
-        for (auto i = 0u; i < values.size(); ++i) {
-            if (it != index.cend() && i == *it) {
-                ++it;
-            } else {
-                new_values.push_back(values[i]);
-            }
-        }
-        values = new_values;
+        shrink_vector(values, shrink_index);
         shrink_index.clear();
         size_changed = true;
     }
@@ -92,10 +526,11 @@ inline void resize_vector(
     if (extend_values.size() > 0) {
         values.insert(
             values.cend(), 
-            extend_values.cbegin(),
-            extend_values.cend()
+            std::make_move_iterator(extend_values.begin()),
+            std::make_move_iterator(extend_values.end())
         );
         extend_values.clear();
+        size_changed = true;
     }
 
     if (size_changed) {
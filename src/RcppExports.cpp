@@ -90,6 +90,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// bitset_memory_usage
+double bitset_memory_usage(const Rcpp::XPtr<individual_index_t> b);
+RcppExport SEXP _individual_bitset_memory_usage(SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::XPtr<individual_index_t> >::type b(bSEXP);
+    rcpp_result_gen = Rcpp::wrap(bitset_memory_usage(b));
+    return rcpp_result_gen;
+END_RCPP
+}
 // bitset_and
 void bitset_and(const Rcpp::XPtr<individual_index_t> a, const Rcpp::XPtr<individual_index_t> b);
 RcppExport SEXP _individual_bitset_and(SEXP aSEXP, SEXP bSEXP) {
@@ -296,6 +307,16 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// categorical_variable_enable_cache
+void categorical_variable_enable_cache(Rcpp::XPtr<CategoricalVariable> variable);
+RcppExport SEXP _individual_categorical_variable_enable_cache(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    categorical_variable_enable_cache(variable);
+    return R_NilValue;
+END_RCPP
+}
 // categorical_variable_get_categories
 std::vector<std::string> categorical_variable_get_categories(Rcpp::XPtr<CategoricalVariable> variable);
 RcppExport SEXP _individual_categorical_variable_get_categories(SEXP variableSEXP) {
@@ -394,6 +415,58 @@ RcppExport SEXP _individual_dummy() {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// crosstab_categorical_internal
+Rcpp::NumericMatrix crosstab_categorical_internal(Rcpp::XPtr<CategoricalVariable> a, Rcpp::XPtr<CategoricalVariable> b);
+RcppExport SEXP _individual_crosstab_categorical_internal(SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type a(aSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type b(bSEXP);
+    rcpp_result_gen = Rcpp::wrap(crosstab_categorical_internal(a, b));
+    return rcpp_result_gen;
+END_RCPP
+}
+// crosstab_categorical_at_index_internal
+Rcpp::NumericMatrix crosstab_categorical_at_index_internal(Rcpp::XPtr<CategoricalVariable> a, Rcpp::XPtr<CategoricalVariable> b, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_crosstab_categorical_at_index_internal(SEXP aSEXP, SEXP bSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type a(aSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type b(bSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(crosstab_categorical_at_index_internal(a, b, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// crosstab_categorical_integer_internal
+Rcpp::NumericMatrix crosstab_categorical_integer_internal(Rcpp::XPtr<CategoricalVariable> a, Rcpp::XPtr<IntegerVariable> b, const std::vector<int>& levels);
+RcppExport SEXP _individual_crosstab_categorical_integer_internal(SEXP aSEXP, SEXP bSEXP, SEXP levelsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type a(aSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type levels(levelsSEXP);
+    rcpp_result_gen = Rcpp::wrap(crosstab_categorical_integer_internal(a, b, levels));
+    return rcpp_result_gen;
+END_RCPP
+}
+// crosstab_categorical_integer_at_index_internal
+Rcpp::NumericMatrix crosstab_categorical_integer_at_index_internal(Rcpp::XPtr<CategoricalVariable> a, Rcpp::XPtr<IntegerVariable> b, const std::vector<int>& levels, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_crosstab_categorical_integer_at_index_internal(SEXP aSEXP, SEXP bSEXP, SEXP levelsSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type a(aSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type levels(levelsSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(crosstab_categorical_integer_at_index_internal(a, b, levels, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // create_double_variable
 Rcpp::XPtr<DoubleVariable> create_double_variable(const std::vector<double>& values);
 RcppExport SEXP _individual_create_double_variable(SEXP valuesSEXP) {
@@ -405,8 +478,20 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// create_compact_double_variable
+Rcpp::XPtr<DoubleVariable> create_compact_double_variable(const std::vector<double>& values, const std::string storage);
+RcppExport SEXP _individual_create_compact_double_variable(SEXP valuesSEXP, SEXP storageSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type storage(storageSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_compact_double_variable(values, storage));
+    return rcpp_result_gen;
+END_RCPP
+}
 // double_variable_get_values
-const std::vector<double>& double_variable_get_values(Rcpp::XPtr<DoubleVariable> variable);
+std::vector<double> double_variable_get_values(Rcpp::XPtr<DoubleVariable> variable);
 RcppExport SEXP _individual_double_variable_get_values(SEXP variableSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -466,6 +551,114 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// double_variable_enable_cache
+void double_variable_enable_cache(Rcpp::XPtr<DoubleVariable> variable);
+RcppExport SEXP _individual_double_variable_enable_cache(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    double_variable_enable_cache(variable);
+    return R_NilValue;
+END_RCPP
+}
+// double_variable_get_summary
+Rcpp::NumericVector double_variable_get_summary(Rcpp::XPtr<DoubleVariable> variable);
+RcppExport SEXP _individual_double_variable_get_summary(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_summary(variable));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_summary_at_index
+Rcpp::NumericVector double_variable_get_summary_at_index(Rcpp::XPtr<DoubleVariable> variable, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_variable_get_summary_at_index(SEXP variableSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_summary_at_index(variable, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_summary_by
+Rcpp::DataFrame double_variable_get_summary_by(Rcpp::XPtr<DoubleVariable> variable, Rcpp::XPtr<CategoricalVariable> group);
+RcppExport SEXP _individual_double_variable_get_summary_by(SEXP variableSEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_summary_by(variable, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_summary_by_at_index
+Rcpp::DataFrame double_variable_get_summary_by_at_index(Rcpp::XPtr<DoubleVariable> variable, Rcpp::XPtr<CategoricalVariable> group, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_variable_get_summary_by_at_index(SEXP variableSEXP, SEXP groupSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_summary_by_at_index(variable, group, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_histogram
+std::vector<size_t> double_variable_get_histogram(Rcpp::XPtr<DoubleVariable> variable, const std::vector<double>& breaks);
+RcppExport SEXP _individual_double_variable_get_histogram(SEXP variableSEXP, SEXP breaksSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type breaks(breaksSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_histogram(variable, breaks));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_histogram_at_index
+std::vector<size_t> double_variable_get_histogram_at_index(Rcpp::XPtr<DoubleVariable> variable, const std::vector<double>& breaks, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_variable_get_histogram_at_index(SEXP variableSEXP, SEXP breaksSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type breaks(breaksSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_histogram_at_index(variable, breaks, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_quantiles
+std::vector<double> double_variable_get_quantiles(Rcpp::XPtr<DoubleVariable> variable, const std::vector<double>& probs);
+RcppExport SEXP _individual_double_variable_get_quantiles(SEXP variableSEXP, SEXP probsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type probs(probsSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_quantiles(variable, probs));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_variable_get_quantiles_at_index
+std::vector<double> double_variable_get_quantiles_at_index(Rcpp::XPtr<DoubleVariable> variable, const std::vector<double>& probs, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_variable_get_quantiles_at_index(SEXP variableSEXP, SEXP probsSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type probs(probsSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_variable_get_quantiles_at_index(variable, probs, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // double_variable_queue_fill
 void double_variable_queue_fill(Rcpp::XPtr<DoubleVariable> variable, std::vector<double> value);
 RcppExport SEXP _individual_double_variable_queue_fill(SEXP variableSEXP, SEXP valueSEXP) {
@@ -598,6 +791,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// event_base_memory_usage
+Rcpp::NumericVector event_base_memory_usage(const Rcpp::XPtr<EventBase> event);
+RcppExport SEXP _individual_event_base_memory_usage(SEXP eventSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::XPtr<EventBase> >::type event(eventSEXP);
+    rcpp_result_gen = Rcpp::wrap(event_base_memory_usage(event));
+    return rcpp_result_gen;
+END_RCPP
+}
 // event_schedule
 void event_schedule(const Rcpp::XPtr<Event> event, std::vector<double> delays);
 RcppExport SEXP _individual_event_schedule(SEXP eventSEXP, SEXP delaysSEXP) {
@@ -843,8 +1047,20 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// create_compact_integer_variable
+Rcpp::XPtr<IntegerVariable> create_compact_integer_variable(const std::vector<int>& values, const std::string storage);
+RcppExport SEXP _individual_create_compact_integer_variable(SEXP valuesSEXP, SEXP storageSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type storage(storageSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_compact_integer_variable(values, storage));
+    return rcpp_result_gen;
+END_RCPP
+}
 // integer_variable_get_values
-const std::vector<int>& integer_variable_get_values(Rcpp::XPtr<IntegerVariable> variable);
+std::vector<int> integer_variable_get_values(Rcpp::XPtr<IntegerVariable> variable);
 RcppExport SEXP _individual_integer_variable_get_values(SEXP variableSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -952,6 +1168,114 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// integer_variable_enable_cache
+void integer_variable_enable_cache(Rcpp::XPtr<IntegerVariable> variable);
+RcppExport SEXP _individual_integer_variable_enable_cache(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    integer_variable_enable_cache(variable);
+    return R_NilValue;
+END_RCPP
+}
+// integer_variable_get_summary
+Rcpp::NumericVector integer_variable_get_summary(Rcpp::XPtr<IntegerVariable> variable);
+RcppExport SEXP _individual_integer_variable_get_summary(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_summary(variable));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_summary_at_index
+Rcpp::NumericVector integer_variable_get_summary_at_index(Rcpp::XPtr<IntegerVariable> variable, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_variable_get_summary_at_index(SEXP variableSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_summary_at_index(variable, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_summary_by
+Rcpp::DataFrame integer_variable_get_summary_by(Rcpp::XPtr<IntegerVariable> variable, Rcpp::XPtr<CategoricalVariable> group);
+RcppExport SEXP _individual_integer_variable_get_summary_by(SEXP variableSEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_summary_by(variable, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_summary_by_at_index
+Rcpp::DataFrame integer_variable_get_summary_by_at_index(Rcpp::XPtr<IntegerVariable> variable, Rcpp::XPtr<CategoricalVariable> group, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_variable_get_summary_by_at_index(SEXP variableSEXP, SEXP groupSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_summary_by_at_index(variable, group, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_histogram
+std::vector<size_t> integer_variable_get_histogram(Rcpp::XPtr<IntegerVariable> variable, const std::vector<double>& breaks);
+RcppExport SEXP _individual_integer_variable_get_histogram(SEXP variableSEXP, SEXP breaksSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type breaks(breaksSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_histogram(variable, breaks));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_histogram_at_index
+std::vector<size_t> integer_variable_get_histogram_at_index(Rcpp::XPtr<IntegerVariable> variable, const std::vector<double>& breaks, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_variable_get_histogram_at_index(SEXP variableSEXP, SEXP breaksSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type breaks(breaksSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_histogram_at_index(variable, breaks, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_quantiles
+std::vector<double> integer_variable_get_quantiles(Rcpp::XPtr<IntegerVariable> variable, const std::vector<double>& probs);
+RcppExport SEXP _individual_integer_variable_get_quantiles(SEXP variableSEXP, SEXP probsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type probs(probsSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_quantiles(variable, probs));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_variable_get_quantiles_at_index
+std::vector<double> integer_variable_get_quantiles_at_index(Rcpp::XPtr<IntegerVariable> variable, const std::vector<double>& probs, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_variable_get_quantiles_at_index(SEXP variableSEXP, SEXP probsSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type probs(probsSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_variable_get_quantiles_at_index(variable, probs, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // integer_variable_queue_fill
 void integer_variable_queue_fill(Rcpp::XPtr<IntegerVariable> variable, std::vector<int> value);
 RcppExport SEXP _individual_integer_variable_queue_fill(SEXP variableSEXP, SEXP valueSEXP) {
@@ -1020,106 +1344,461 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
-// fixed_probability_multinomial_process_internal
-Rcpp::XPtr<process_t> fixed_probability_multinomial_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string source_state, const std::vector<std::string> destination_states, const double rate, const std::vector<double> destination_probabilities);
-RcppExport SEXP _individual_fixed_probability_multinomial_process_internal(SEXP variableSEXP, SEXP source_stateSEXP, SEXP destination_statesSEXP, SEXP rateSEXP, SEXP destination_probabilitiesSEXP) {
+// create_memory_report
+Rcpp::XPtr<MemoryReport> create_memory_report(size_t every);
+RcppExport SEXP _individual_create_memory_report(SEXP everySEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type source_state(source_stateSEXP);
-    Rcpp::traits::input_parameter< const std::vector<std::string> >::type destination_states(destination_statesSEXP);
-    Rcpp::traits::input_parameter< const double >::type rate(rateSEXP);
-    Rcpp::traits::input_parameter< const std::vector<double> >::type destination_probabilities(destination_probabilitiesSEXP);
-    rcpp_result_gen = Rcpp::wrap(fixed_probability_multinomial_process_internal(variable, source_state, destination_states, rate, destination_probabilities));
+    Rcpp::traits::input_parameter< size_t >::type every(everySEXP);
+    rcpp_result_gen = Rcpp::wrap(create_memory_report(every));
     return rcpp_result_gen;
 END_RCPP
 }
-// multi_probability_multinomial_process_internal
-Rcpp::XPtr<process_t> multi_probability_multinomial_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string source_state, const std::vector<std::string> destination_states, const Rcpp::XPtr<DoubleVariable> rate_variable, const std::vector<double> destination_probabilities);
-RcppExport SEXP _individual_multi_probability_multinomial_process_internal(SEXP variableSEXP, SEXP source_stateSEXP, SEXP destination_statesSEXP, SEXP rate_variableSEXP, SEXP destination_probabilitiesSEXP) {
+// memory_report_should_report
+bool memory_report_should_report(Rcpp::XPtr<MemoryReport> report, size_t timestep);
+RcppExport SEXP _individual_memory_report_should_report(SEXP reportSEXP, SEXP timestepSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type source_state(source_stateSEXP);
-    Rcpp::traits::input_parameter< const std::vector<std::string> >::type destination_states(destination_statesSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::XPtr<DoubleVariable> >::type rate_variable(rate_variableSEXP);
-    Rcpp::traits::input_parameter< const std::vector<double> >::type destination_probabilities(destination_probabilitiesSEXP);
-    rcpp_result_gen = Rcpp::wrap(multi_probability_multinomial_process_internal(variable, source_state, destination_states, rate_variable, destination_probabilities));
+    Rcpp::traits::input_parameter< Rcpp::XPtr<MemoryReport> >::type report(reportSEXP);
+    Rcpp::traits::input_parameter< size_t >::type timestep(timestepSEXP);
+    rcpp_result_gen = Rcpp::wrap(memory_report_should_report(report, timestep));
     return rcpp_result_gen;
 END_RCPP
 }
-// multi_probability_bernoulli_process_internal
-Rcpp::XPtr<process_t> multi_probability_bernoulli_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string from, const std::string to, const Rcpp::XPtr<DoubleVariable> rate_variable);
-RcppExport SEXP _individual_multi_probability_bernoulli_process_internal(SEXP variableSEXP, SEXP fromSEXP, SEXP toSEXP, SEXP rate_variableSEXP) {
+// memory_report_record
+void memory_report_record(Rcpp::XPtr<MemoryReport> report, size_t timestep, const std::string kind, const std::string name, Rcpp::NumericVector usage);
+RcppExport SEXP _individual_memory_report_record(SEXP reportSEXP, SEXP timestepSEXP, SEXP kindSEXP, SEXP nameSEXP, SEXP usageSEXP) {
 BEGIN_RCPP
-    Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type from(fromSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type to(toSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::XPtr<DoubleVariable> >::type rate_variable(rate_variableSEXP);
-    rcpp_result_gen = Rcpp::wrap(multi_probability_bernoulli_process_internal(variable, from, to, rate_variable));
-    return rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<MemoryReport> >::type report(reportSEXP);
+    Rcpp::traits::input_parameter< size_t >::type timestep(timestepSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type kind(kindSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type name(nameSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type usage(usageSEXP);
+    memory_report_record(report, timestep, kind, name, usage);
+    return R_NilValue;
 END_RCPP
 }
-// infection_age_process_internal
-Rcpp::XPtr<process_t> infection_age_process_internal(Rcpp::XPtr<CategoricalVariable> state, const std::string susceptible, const std::string exposed, const std::string infectious, const Rcpp::XPtr<IntegerVariable> age, const int age_bins, const double p, const double dt, const Rcpp::NumericMatrix mixing);
-RcppExport SEXP _individual_infection_age_process_internal(SEXP stateSEXP, SEXP susceptibleSEXP, SEXP exposedSEXP, SEXP infectiousSEXP, SEXP ageSEXP, SEXP age_binsSEXP, SEXP pSEXP, SEXP dtSEXP, SEXP mixingSEXP) {
+// memory_report_data
+Rcpp::List memory_report_data(Rcpp::XPtr<MemoryReport> report);
+RcppExport SEXP _individual_memory_report_data(SEXP reportSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type state(stateSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type susceptible(susceptibleSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type exposed(exposedSEXP);
-    Rcpp::traits::input_parameter< const std::string >::type infectious(infectiousSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::XPtr<IntegerVariable> >::type age(ageSEXP);
-    Rcpp::traits::input_parameter< const int >::type age_bins(age_binsSEXP);
-    Rcpp::traits::input_parameter< const double >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const double >::type dt(dtSEXP);
-    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix >::type mixing(mixingSEXP);
-    rcpp_result_gen = Rcpp::wrap(infection_age_process_internal(state, susceptible, exposed, infectious, age, age_bins, p, dt, mixing));
+    Rcpp::traits::input_parameter< Rcpp::XPtr<MemoryReport> >::type report(reportSEXP);
+    rcpp_result_gen = Rcpp::wrap(memory_report_data(report));
     return rcpp_result_gen;
 END_RCPP
 }
-// create_double_ragged_variable
-Rcpp::XPtr<RaggedDouble> create_double_ragged_variable(const std::vector<std::vector<double>>& values);
-RcppExport SEXP _individual_create_double_ragged_variable(SEXP valuesSEXP) {
+// create_population
+Rcpp::XPtr<Population> create_population(size_t size, double compaction_threshold);
+RcppExport SEXP _individual_create_population(SEXP sizeSEXP, SEXP compaction_thresholdSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const std::vector<std::vector<double>>& >::type values(valuesSEXP);
-    rcpp_result_gen = Rcpp::wrap(create_double_ragged_variable(values));
+    Rcpp::traits::input_parameter< size_t >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< double >::type compaction_threshold(compaction_thresholdSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_population(size, compaction_threshold));
     return rcpp_result_gen;
 END_RCPP
 }
-// double_ragged_variable_get_values
-std::vector<std::vector<double>> double_ragged_variable_get_values(Rcpp::XPtr<RaggedDouble> variable);
-RcppExport SEXP _individual_double_ragged_variable_get_values(SEXP variableSEXP) {
+// population_get_alive
+Rcpp::XPtr<individual_index_t> population_get_alive(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_get_alive(SEXP populationSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
-    rcpp_result_gen = Rcpp::wrap(double_ragged_variable_get_values(variable));
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_get_alive(population));
     return rcpp_result_gen;
 END_RCPP
 }
-// double_ragged_variable_get_values_at_index_bitset
-std::vector<std::vector<double>> double_ragged_variable_get_values_at_index_bitset(Rcpp::XPtr<RaggedDouble> variable, Rcpp::XPtr<individual_index_t> index);
-RcppExport SEXP _individual_double_ragged_variable_get_values_at_index_bitset(SEXP variableSEXP, SEXP indexSEXP) {
+// population_get_free
+Rcpp::XPtr<individual_index_t> population_get_free(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_get_free(SEXP populationSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
-    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
-    rcpp_result_gen = Rcpp::wrap(double_ragged_variable_get_values_at_index_bitset(variable, index));
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_get_free(population));
     return rcpp_result_gen;
 END_RCPP
 }
-// double_ragged_variable_get_values_at_index_vector
-std::vector<std::vector<double>> double_ragged_variable_get_values_at_index_vector(Rcpp::XPtr<RaggedDouble> variable, std::vector<size_t> index);
-RcppExport SEXP _individual_double_ragged_variable_get_values_at_index_vector(SEXP variableSEXP, SEXP indexSEXP) {
+// population_filter
+void population_filter(Rcpp::XPtr<Population> population, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_population_filter(SEXP populationSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    population_filter(population, index);
+    return R_NilValue;
+END_RCPP
+}
+// population_memory_usage
+Rcpp::NumericVector population_memory_usage(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_memory_usage(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_memory_usage(population));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_get_size
+size_t population_get_size(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_get_size(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_get_size(population));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_get_capacity
+size_t population_get_capacity(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_get_capacity(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_get_capacity(population));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_queue_shrink
+void population_queue_shrink(Rcpp::XPtr<Population> population, std::vector<size_t>& index);
+RcppExport SEXP _individual_population_queue_shrink(SEXP populationSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    Rcpp::traits::input_parameter< std::vector<size_t>& >::type index(indexSEXP);
+    population_queue_shrink(population, index);
+    return R_NilValue;
+END_RCPP
+}
+// population_queue_shrink_bitset
+void population_queue_shrink_bitset(Rcpp::XPtr<Population> population, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_population_queue_shrink_bitset(SEXP populationSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    population_queue_shrink_bitset(population, index);
+    return R_NilValue;
+END_RCPP
+}
+// population_queue_extend
+std::vector<size_t> population_queue_extend(Rcpp::XPtr<Population> population, size_t n);
+RcppExport SEXP _individual_population_queue_extend(SEXP populationSEXP, SEXP nSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_queue_extend(population, n));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_resize
+void population_resize(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_resize(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    population_resize(population);
+    return R_NilValue;
+END_RCPP
+}
+// population_should_compact
+bool population_should_compact(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_should_compact(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_should_compact(population));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_compact
+Rcpp::XPtr<individual_index_t> population_compact(Rcpp::XPtr<Population> population);
+RcppExport SEXP _individual_population_compact(SEXP populationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    rcpp_result_gen = Rcpp::wrap(population_compact(population));
+    return rcpp_result_gen;
+END_RCPP
+}
+// population_restore
+void population_restore(Rcpp::XPtr<Population> population, Rcpp::XPtr<individual_index_t> alive);
+RcppExport SEXP _individual_population_restore(SEXP populationSEXP, SEXP aliveSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Population> >::type population(populationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type alive(aliveSEXP);
+    population_restore(population, alive);
+    return R_NilValue;
+END_RCPP
+}
+// fixed_probability_multinomial_process_internal
+Rcpp::XPtr<process_t> fixed_probability_multinomial_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string source_state, const std::vector<std::string> destination_states, const double rate, const std::vector<double> destination_probabilities);
+RcppExport SEXP _individual_fixed_probability_multinomial_process_internal(SEXP variableSEXP, SEXP source_stateSEXP, SEXP destination_statesSEXP, SEXP rateSEXP, SEXP destination_probabilitiesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type source_state(source_stateSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string> >::type destination_states(destination_statesSEXP);
+    Rcpp::traits::input_parameter< const double >::type rate(rateSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type destination_probabilities(destination_probabilitiesSEXP);
+    rcpp_result_gen = Rcpp::wrap(fixed_probability_multinomial_process_internal(variable, source_state, destination_states, rate, destination_probabilities));
+    return rcpp_result_gen;
+END_RCPP
+}
+// multi_probability_multinomial_process_internal
+Rcpp::XPtr<process_t> multi_probability_multinomial_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string source_state, const std::vector<std::string> destination_states, const Rcpp::XPtr<DoubleVariable> rate_variable, const std::vector<double> destination_probabilities);
+RcppExport SEXP _individual_multi_probability_multinomial_process_internal(SEXP variableSEXP, SEXP source_stateSEXP, SEXP destination_statesSEXP, SEXP rate_variableSEXP, SEXP destination_probabilitiesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type source_state(source_stateSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string> >::type destination_states(destination_statesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::XPtr<DoubleVariable> >::type rate_variable(rate_variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type destination_probabilities(destination_probabilitiesSEXP);
+    rcpp_result_gen = Rcpp::wrap(multi_probability_multinomial_process_internal(variable, source_state, destination_states, rate_variable, destination_probabilities));
+    return rcpp_result_gen;
+END_RCPP
+}
+// multi_probability_bernoulli_process_internal
+Rcpp::XPtr<process_t> multi_probability_bernoulli_process_internal(Rcpp::XPtr<CategoricalVariable> variable, const std::string from, const std::string to, const Rcpp::XPtr<DoubleVariable> rate_variable);
+RcppExport SEXP _individual_multi_probability_bernoulli_process_internal(SEXP variableSEXP, SEXP fromSEXP, SEXP toSEXP, SEXP rate_variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type from(fromSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type to(toSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::XPtr<DoubleVariable> >::type rate_variable(rate_variableSEXP);
+    rcpp_result_gen = Rcpp::wrap(multi_probability_bernoulli_process_internal(variable, from, to, rate_variable));
+    return rcpp_result_gen;
+END_RCPP
+}
+// infection_age_process_internal
+Rcpp::XPtr<process_t> infection_age_process_internal(Rcpp::XPtr<CategoricalVariable> state, const std::string susceptible, const std::string exposed, const std::string infectious, const Rcpp::XPtr<IntegerVariable> age, const int age_bins, const double p, const double dt, const Rcpp::NumericMatrix mixing);
+RcppExport SEXP _individual_infection_age_process_internal(SEXP stateSEXP, SEXP susceptibleSEXP, SEXP exposedSEXP, SEXP infectiousSEXP, SEXP ageSEXP, SEXP age_binsSEXP, SEXP pSEXP, SEXP dtSEXP, SEXP mixingSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type state(stateSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type susceptible(susceptibleSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type exposed(exposedSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type infectious(infectiousSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::XPtr<IntegerVariable> >::type age(ageSEXP);
+    Rcpp::traits::input_parameter< const int >::type age_bins(age_binsSEXP);
+    Rcpp::traits::input_parameter< const double >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const double >::type dt(dtSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix >::type mixing(mixingSEXP);
+    rcpp_result_gen = Rcpp::wrap(infection_age_process_internal(state, susceptible, exposed, infectious, age, age_bins, p, dt, mixing));
+    return rcpp_result_gen;
+END_RCPP
+}
+// categorical_count_renderer_process_internal
+Rcpp::XPtr<process_t> categorical_count_renderer_process_internal(Rcpp::List renders, Rcpp::XPtr<CategoricalVariable> variable, const std::vector<std::string> categories);
+RcppExport SEXP _individual_categorical_count_renderer_process_internal(SEXP rendersSEXP, SEXP variableSEXP, SEXP categoriesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::List >::type renders(rendersSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string> >::type categories(categoriesSEXP);
+    rcpp_result_gen = Rcpp::wrap(categorical_count_renderer_process_internal(renders, variable, categories));
+    return rcpp_result_gen;
+END_RCPP
+}
+// create_profiler
+Rcpp::XPtr<Profiler> create_profiler();
+RcppExport SEXP _individual_create_profiler() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(create_profiler());
+    return rcpp_result_gen;
+END_RCPP
+}
+// profiler_now
+double profiler_now();
+RcppExport SEXP _individual_profiler_now() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(profiler_now());
+    return rcpp_result_gen;
+END_RCPP
+}
+// profiler_record
+void profiler_record(Rcpp::XPtr<Profiler> profiler, size_t timestep, const std::string kind, const std::string name, double start);
+RcppExport SEXP _individual_profiler_record(SEXP profilerSEXP, SEXP timestepSEXP, SEXP kindSEXP, SEXP nameSEXP, SEXP startSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Profiler> >::type profiler(profilerSEXP);
+    Rcpp::traits::input_parameter< size_t >::type timestep(timestepSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type kind(kindSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type name(nameSEXP);
+    Rcpp::traits::input_parameter< double >::type start(startSEXP);
+    profiler_record(profiler, timestep, kind, name, start);
+    return R_NilValue;
+END_RCPP
+}
+// profiler_data
+Rcpp::List profiler_data(Rcpp::XPtr<Profiler> profiler);
+RcppExport SEXP _individual_profiler_data(SEXP profilerSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Profiler> >::type profiler(profilerSEXP);
+    rcpp_result_gen = Rcpp::wrap(profiler_data(profiler));
+    return rcpp_result_gen;
+END_RCPP
+}
+// create_query
+Rcpp::XPtr<Query> create_query();
+RcppExport SEXP _individual_create_query() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(create_query());
+    return rcpp_result_gen;
+END_RCPP
+}
+// query_add_categorical
+void query_add_categorical(Rcpp::XPtr<Query> query, Rcpp::XPtr<CategoricalVariable> variable, const std::vector<std::string>& categories);
+RcppExport SEXP _individual_query_add_categorical(SEXP querySEXP, SEXP variableSEXP, SEXP categoriesSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<CategoricalVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<std::string>& >::type categories(categoriesSEXP);
+    query_add_categorical(query, variable, categories);
+    return R_NilValue;
+END_RCPP
+}
+// query_add_integer_set
+void query_add_integer_set(Rcpp::XPtr<Query> query, Rcpp::XPtr<IntegerVariable> variable, const std::vector<int>& set);
+RcppExport SEXP _individual_query_add_integer_set(SEXP querySEXP, SEXP variableSEXP, SEXP setSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type set(setSEXP);
+    query_add_integer_set(query, variable, set);
+    return R_NilValue;
+END_RCPP
+}
+// query_add_integer_range
+void query_add_integer_range(Rcpp::XPtr<Query> query, Rcpp::XPtr<IntegerVariable> variable, const int a, const int b);
+RcppExport SEXP _individual_query_add_integer_range(SEXP querySEXP, SEXP variableSEXP, SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<IntegerVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const int >::type b(bSEXP);
+    query_add_integer_range(query, variable, a, b);
+    return R_NilValue;
+END_RCPP
+}
+// query_add_double_range
+void query_add_double_range(Rcpp::XPtr<Query> query, Rcpp::XPtr<DoubleVariable> variable, const double a, const double b);
+RcppExport SEXP _individual_query_add_double_range(SEXP querySEXP, SEXP variableSEXP, SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<DoubleVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const double >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const double >::type b(bSEXP);
+    query_add_double_range(query, variable, a, b);
+    return R_NilValue;
+END_RCPP
+}
+// query_evaluate
+Rcpp::XPtr<individual_index_t> query_evaluate(Rcpp::XPtr<Query> query);
+RcppExport SEXP _individual_query_evaluate(SEXP querySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    rcpp_result_gen = Rcpp::wrap(query_evaluate(query));
+    return rcpp_result_gen;
+END_RCPP
+}
+// query_evaluate_within
+Rcpp::XPtr<individual_index_t> query_evaluate_within(Rcpp::XPtr<Query> query, Rcpp::XPtr<individual_index_t> within);
+RcppExport SEXP _individual_query_evaluate_within(SEXP querySEXP, SEXP withinSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Query> >::type query(querySEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type within(withinSEXP);
+    rcpp_result_gen = Rcpp::wrap(query_evaluate_within(query, within));
+    return rcpp_result_gen;
+END_RCPP
+}
+// create_double_ragged_variable
+Rcpp::XPtr<RaggedDouble> create_double_ragged_variable(const std::vector<std::vector<double>>& values);
+RcppExport SEXP _individual_create_double_ragged_variable(SEXP valuesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<std::vector<double>>& >::type values(valuesSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_double_ragged_variable(values));
+    return rcpp_result_gen;
+END_RCPP
+}
+// create_flat_double_ragged_variable
+Rcpp::XPtr<RaggedDouble> create_flat_double_ragged_variable(const std::vector<std::vector<double>>& values);
+RcppExport SEXP _individual_create_flat_double_ragged_variable(SEXP valuesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<std::vector<double>>& >::type values(valuesSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_flat_double_ragged_variable(values));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_ragged_variable_get_values
+std::vector<std::vector<double>> double_ragged_variable_get_values(Rcpp::XPtr<RaggedDouble> variable);
+RcppExport SEXP _individual_double_ragged_variable_get_values(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_ragged_variable_get_values(variable));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_ragged_variable_get_values_at_index_bitset
+std::vector<std::vector<double>> double_ragged_variable_get_values_at_index_bitset(Rcpp::XPtr<RaggedDouble> variable, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_ragged_variable_get_values_at_index_bitset(SEXP variableSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_ragged_variable_get_values_at_index_bitset(variable, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// double_ragged_variable_get_values_at_index_vector
+std::vector<std::vector<double>> double_ragged_variable_get_values_at_index_vector(Rcpp::XPtr<RaggedDouble> variable, std::vector<size_t> index);
+RcppExport SEXP _individual_double_ragged_variable_get_values_at_index_vector(SEXP variableSEXP, SEXP indexSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -1129,6 +1808,18 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// double_ragged_variable_get_index_of_contains
+Rcpp::XPtr<individual_index_t> double_ragged_variable_get_index_of_contains(Rcpp::XPtr<RaggedDouble> variable, const double value);
+RcppExport SEXP _individual_double_ragged_variable_get_index_of_contains(SEXP variableSEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const double >::type value(valueSEXP);
+    rcpp_result_gen = Rcpp::wrap(double_ragged_variable_get_index_of_contains(variable, value));
+    return rcpp_result_gen;
+END_RCPP
+}
 // double_ragged_variable_get_length
 std::vector<size_t> double_ragged_variable_get_length(Rcpp::XPtr<RaggedDouble> variable);
 RcppExport SEXP _individual_double_ragged_variable_get_length(SEXP variableSEXP) {
@@ -1199,6 +1890,55 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// double_ragged_variable_queue_push_back
+void double_ragged_variable_queue_push_back(Rcpp::XPtr<RaggedDouble> variable, const double value, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_ragged_variable_queue_push_back(SEXP variableSEXP, SEXP valueSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const double >::type value(valueSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    double_ragged_variable_queue_push_back(variable, value, index);
+    return R_NilValue;
+END_RCPP
+}
+// double_ragged_variable_queue_remove
+void double_ragged_variable_queue_remove(Rcpp::XPtr<RaggedDouble> variable, const double value, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_ragged_variable_queue_remove(SEXP variableSEXP, SEXP valueSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const double >::type value(valueSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    double_ragged_variable_queue_remove(variable, value, index);
+    return R_NilValue;
+END_RCPP
+}
+// double_ragged_variable_queue_remove_range
+void double_ragged_variable_queue_remove_range(Rcpp::XPtr<RaggedDouble> variable, const double a, const double b, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_ragged_variable_queue_remove_range(SEXP variableSEXP, SEXP aSEXP, SEXP bSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const double >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const double >::type b(bSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    double_ragged_variable_queue_remove_range(variable, a, b, index);
+    return R_NilValue;
+END_RCPP
+}
+// double_ragged_variable_queue_truncate
+void double_ragged_variable_queue_truncate(Rcpp::XPtr<RaggedDouble> variable, const size_t length, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_double_ragged_variable_queue_truncate(SEXP variableSEXP, SEXP lengthSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedDouble> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const size_t >::type length(lengthSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    double_ragged_variable_queue_truncate(variable, length, index);
+    return R_NilValue;
+END_RCPP
+}
 // double_ragged_variable_queue_extend
 void double_ragged_variable_queue_extend(Rcpp::XPtr<RaggedDouble> variable, std::vector<std::vector<double>>& values);
 RcppExport SEXP _individual_double_ragged_variable_queue_extend(SEXP variableSEXP, SEXP valuesSEXP) {
@@ -1243,6 +1983,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// create_flat_integer_ragged_variable
+Rcpp::XPtr<RaggedInteger> create_flat_integer_ragged_variable(const std::vector<std::vector<int>>& values);
+RcppExport SEXP _individual_create_flat_integer_ragged_variable(SEXP valuesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<std::vector<int>>& >::type values(valuesSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_flat_integer_ragged_variable(values));
+    return rcpp_result_gen;
+END_RCPP
+}
 // integer_ragged_variable_get_values
 std::vector<std::vector<int>> integer_ragged_variable_get_values(Rcpp::XPtr<RaggedInteger> variable);
 RcppExport SEXP _individual_integer_ragged_variable_get_values(SEXP variableSEXP) {
@@ -1278,6 +2029,28 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// integer_ragged_variable_get_index_of_contains
+Rcpp::XPtr<individual_index_t> integer_ragged_variable_get_index_of_contains(Rcpp::XPtr<RaggedInteger> variable, const int value);
+RcppExport SEXP _individual_integer_ragged_variable_get_index_of_contains(SEXP variableSEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type value(valueSEXP);
+    rcpp_result_gen = Rcpp::wrap(integer_ragged_variable_get_index_of_contains(variable, value));
+    return rcpp_result_gen;
+END_RCPP
+}
+// integer_ragged_variable_enable_inverted_index
+void integer_ragged_variable_enable_inverted_index(Rcpp::XPtr<RaggedInteger> variable);
+RcppExport SEXP _individual_integer_ragged_variable_enable_inverted_index(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    integer_ragged_variable_enable_inverted_index(variable);
+    return R_NilValue;
+END_RCPP
+}
 // integer_ragged_variable_get_length
 std::vector<size_t> integer_ragged_variable_get_length(Rcpp::XPtr<RaggedInteger> variable);
 RcppExport SEXP _individual_integer_ragged_variable_get_length(SEXP variableSEXP) {
@@ -1348,6 +2121,55 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// integer_ragged_variable_queue_push_back
+void integer_ragged_variable_queue_push_back(Rcpp::XPtr<RaggedInteger> variable, const int value, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_ragged_variable_queue_push_back(SEXP variableSEXP, SEXP valueSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type value(valueSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    integer_ragged_variable_queue_push_back(variable, value, index);
+    return R_NilValue;
+END_RCPP
+}
+// integer_ragged_variable_queue_remove
+void integer_ragged_variable_queue_remove(Rcpp::XPtr<RaggedInteger> variable, const int value, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_ragged_variable_queue_remove(SEXP variableSEXP, SEXP valueSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type value(valueSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    integer_ragged_variable_queue_remove(variable, value, index);
+    return R_NilValue;
+END_RCPP
+}
+// integer_ragged_variable_queue_remove_range
+void integer_ragged_variable_queue_remove_range(Rcpp::XPtr<RaggedInteger> variable, const int a, const int b, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_ragged_variable_queue_remove_range(SEXP variableSEXP, SEXP aSEXP, SEXP bSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const int >::type b(bSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    integer_ragged_variable_queue_remove_range(variable, a, b, index);
+    return R_NilValue;
+END_RCPP
+}
+// integer_ragged_variable_queue_truncate
+void integer_ragged_variable_queue_truncate(Rcpp::XPtr<RaggedInteger> variable, const size_t length, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_integer_ragged_variable_queue_truncate(SEXP variableSEXP, SEXP lengthSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<RaggedInteger> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const size_t >::type length(lengthSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    integer_ragged_variable_queue_truncate(variable, length, index);
+    return R_NilValue;
+END_RCPP
+}
 // integer_ragged_variable_queue_extend
 void integer_ragged_variable_queue_extend(Rcpp::XPtr<RaggedInteger> variable, std::vector<std::vector<int>>& values);
 RcppExport SEXP _individual_integer_ragged_variable_queue_extend(SEXP variableSEXP, SEXP valuesSEXP) {
@@ -1415,6 +2237,108 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// create_resize_coordinator
+Rcpp::XPtr<ResizeCoordinator> create_resize_coordinator(size_t size, size_t threads, bool ordered);
+RcppExport SEXP _individual_create_resize_coordinator(SEXP sizeSEXP, SEXP threadsSEXP, SEXP orderedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< size_t >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< size_t >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< bool >::type ordered(orderedSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_resize_coordinator(size, threads, ordered));
+    return rcpp_result_gen;
+END_RCPP
+}
+// resize_coordinator_add_variable
+void resize_coordinator_add_variable(Rcpp::XPtr<ResizeCoordinator> coordinator, Rcpp::XPtr<Variable> variable);
+RcppExport SEXP _individual_resize_coordinator_add_variable(SEXP coordinatorSEXP, SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Variable> >::type variable(variableSEXP);
+    resize_coordinator_add_variable(coordinator, variable);
+    return R_NilValue;
+END_RCPP
+}
+// resize_coordinator_add_event
+void resize_coordinator_add_event(Rcpp::XPtr<ResizeCoordinator> coordinator, Rcpp::XPtr<TargetedEvent> event);
+RcppExport SEXP _individual_resize_coordinator_add_event(SEXP coordinatorSEXP, SEXP eventSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TargetedEvent> >::type event(eventSEXP);
+    resize_coordinator_add_event(coordinator, event);
+    return R_NilValue;
+END_RCPP
+}
+// resize_coordinator_queue_shrink_bitset
+void resize_coordinator_queue_shrink_bitset(Rcpp::XPtr<ResizeCoordinator> coordinator, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_resize_coordinator_queue_shrink_bitset(SEXP coordinatorSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    resize_coordinator_queue_shrink_bitset(coordinator, index);
+    return R_NilValue;
+END_RCPP
+}
+// resize_coordinator_has_queued_shrink
+bool resize_coordinator_has_queued_shrink(Rcpp::XPtr<ResizeCoordinator> coordinator);
+RcppExport SEXP _individual_resize_coordinator_has_queued_shrink(SEXP coordinatorSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    rcpp_result_gen = Rcpp::wrap(resize_coordinator_has_queued_shrink(coordinator));
+    return rcpp_result_gen;
+END_RCPP
+}
+// resize_coordinator_tombstone
+void resize_coordinator_tombstone(Rcpp::XPtr<ResizeCoordinator> coordinator, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_resize_coordinator_tombstone(SEXP coordinatorSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    resize_coordinator_tombstone(coordinator, index);
+    return R_NilValue;
+END_RCPP
+}
+// resize_coordinator_resize
+void resize_coordinator_resize(Rcpp::XPtr<ResizeCoordinator> coordinator);
+RcppExport SEXP _individual_resize_coordinator_resize(SEXP coordinatorSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    resize_coordinator_resize(coordinator);
+    return R_NilValue;
+END_RCPP
+}
+// resize_coordinator_remap
+Rcpp::NumericVector resize_coordinator_remap(Rcpp::XPtr<ResizeCoordinator> coordinator, std::vector<size_t> index);
+RcppExport SEXP _individual_resize_coordinator_remap(SEXP coordinatorSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< std::vector<size_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(resize_coordinator_remap(coordinator, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// resize_coordinator_remap_bitset
+Rcpp::XPtr<individual_index_t> resize_coordinator_remap_bitset(Rcpp::XPtr<ResizeCoordinator> coordinator, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_resize_coordinator_remap_bitset(SEXP coordinatorSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<ResizeCoordinator> >::type coordinator(coordinatorSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(resize_coordinator_remap_bitset(coordinator, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // execute_process
 void execute_process(Rcpp::XPtr<process_t> process, size_t timestep);
 RcppExport SEXP _individual_execute_process(SEXP processSEXP, SEXP timestepSEXP) {
@@ -1426,6 +2350,177 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// execute_simulation
+void execute_simulation(Rcpp::List processes, Rcpp::List variables, Rcpp::List events, std::vector<bool> targeted, Rcpp::List listeners, size_t start, size_t end, size_t threads, double seed, std::vector<std::string> process_names, std::vector<std::string> variable_names, std::vector<std::string> event_names, SEXP profiler, SEXP memory_report);
+RcppExport SEXP _individual_execute_simulation(SEXP processesSEXP, SEXP variablesSEXP, SEXP eventsSEXP, SEXP targetedSEXP, SEXP listenersSEXP, SEXP startSEXP, SEXP endSEXP, SEXP threadsSEXP, SEXP seedSEXP, SEXP process_namesSEXP, SEXP variable_namesSEXP, SEXP event_namesSEXP, SEXP profilerSEXP, SEXP memory_reportSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::List >::type processes(processesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::List >::type variables(variablesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::List >::type events(eventsSEXP);
+    Rcpp::traits::input_parameter< std::vector<bool> >::type targeted(targetedSEXP);
+    Rcpp::traits::input_parameter< Rcpp::List >::type listeners(listenersSEXP);
+    Rcpp::traits::input_parameter< size_t >::type start(startSEXP);
+    Rcpp::traits::input_parameter< size_t >::type end(endSEXP);
+    Rcpp::traits::input_parameter< size_t >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< double >::type seed(seedSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type process_names(process_namesSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type variable_names(variable_namesSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type event_names(event_namesSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type profiler(profilerSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type memory_report(memory_reportSEXP);
+    execute_simulation(processes, variables, events, targeted, listeners, start, end, threads, seed, process_names, variable_names, event_names, profiler, memory_report);
+    return R_NilValue;
+END_RCPP
+}
+// execute_ensemble
+void execute_ensemble(Rcpp::List replicates, size_t start, size_t end, size_t threads, double seed);
+RcppExport SEXP _individual_execute_ensemble(SEXP replicatesSEXP, SEXP startSEXP, SEXP endSEXP, SEXP threadsSEXP, SEXP seedSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::List >::type replicates(replicatesSEXP);
+    Rcpp::traits::input_parameter< size_t >::type start(startSEXP);
+    Rcpp::traits::input_parameter< size_t >::type end(endSEXP);
+    Rcpp::traits::input_parameter< size_t >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< double >::type seed(seedSEXP);
+    execute_ensemble(replicates, start, end, threads, seed);
+    return R_NilValue;
+END_RCPP
+}
+// create_time_variable
+Rcpp::XPtr<TimeVariable> create_time_variable(const std::vector<int>& anchors, const bool since);
+RcppExport SEXP _individual_create_time_variable(SEXP anchorsSEXP, SEXP sinceSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<int>& >::type anchors(anchorsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type since(sinceSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_time_variable(anchors, since));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_values
+std::vector<int> time_variable_get_values(Rcpp::XPtr<TimeVariable> variable, const int t);
+RcppExport SEXP _individual_time_variable_get_values(SEXP variableSEXP, SEXP tSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_values(variable, t));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_values_at_index
+std::vector<int> time_variable_get_values_at_index(Rcpp::XPtr<TimeVariable> variable, const int t, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_time_variable_get_values_at_index(SEXP variableSEXP, SEXP tSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_values_at_index(variable, t, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_values_at_index_vector
+std::vector<int> time_variable_get_values_at_index_vector(Rcpp::XPtr<TimeVariable> variable, const int t, std::vector<size_t> index);
+RcppExport SEXP _individual_time_variable_get_values_at_index_vector(SEXP variableSEXP, SEXP tSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< std::vector<size_t> >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_values_at_index_vector(variable, t, index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_index_of_set
+Rcpp::XPtr<individual_index_t> time_variable_get_index_of_set(Rcpp::XPtr<TimeVariable> variable, const int t, const std::vector<int> values_set);
+RcppExport SEXP _individual_time_variable_get_index_of_set(SEXP variableSEXP, SEXP tSEXP, SEXP values_setSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int> >::type values_set(values_setSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_index_of_set(variable, t, values_set));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_index_of_range
+Rcpp::XPtr<individual_index_t> time_variable_get_index_of_range(Rcpp::XPtr<TimeVariable> variable, const int t, const int a, const int b);
+RcppExport SEXP _individual_time_variable_get_index_of_range(SEXP variableSEXP, SEXP tSEXP, SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< const int >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const int >::type b(bSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_index_of_range(variable, t, a, b));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_size_of_set
+size_t time_variable_get_size_of_set(Rcpp::XPtr<TimeVariable> variable, const int t, const std::vector<int> values_set);
+RcppExport SEXP _individual_time_variable_get_size_of_set(SEXP variableSEXP, SEXP tSEXP, SEXP values_setSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< const std::vector<int> >::type values_set(values_setSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_size_of_set(variable, t, values_set));
+    return rcpp_result_gen;
+END_RCPP
+}
+// time_variable_get_size_of_range
+size_t time_variable_get_size_of_range(Rcpp::XPtr<TimeVariable> variable, const int t, const int a, const int b);
+RcppExport SEXP _individual_time_variable_get_size_of_range(SEXP variableSEXP, SEXP tSEXP, SEXP aSEXP, SEXP bSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<TimeVariable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< const int >::type t(tSEXP);
+    Rcpp::traits::input_parameter< const int >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const int >::type b(bSEXP);
+    rcpp_result_gen = Rcpp::wrap(time_variable_get_size_of_range(variable, t, a, b));
+    return rcpp_result_gen;
+END_RCPP
+}
+// trace_start
+void trace_start(size_t capacity);
+RcppExport SEXP _individual_trace_start(SEXP capacitySEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< size_t >::type capacity(capacitySEXP);
+    trace_start(capacity);
+    return R_NilValue;
+END_RCPP
+}
+// trace_active
+bool trace_active();
+RcppExport SEXP _individual_trace_active() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(trace_active());
+    return rcpp_result_gen;
+END_RCPP
+}
+// trace_stop
+void trace_stop(std::string path);
+RcppExport SEXP _individual_trace_stop(SEXP pathSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    trace_stop(path);
+    return R_NilValue;
+END_RCPP
+}
 // variable_get_size
 size_t variable_get_size(Rcpp::XPtr<Variable> variable);
 RcppExport SEXP _individual_variable_get_size(SEXP variableSEXP) {
@@ -1437,6 +2532,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// variable_memory_usage
+Rcpp::NumericVector variable_memory_usage(Rcpp::XPtr<Variable> variable);
+RcppExport SEXP _individual_variable_memory_usage(SEXP variableSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Variable> >::type variable(variableSEXP);
+    rcpp_result_gen = Rcpp::wrap(variable_memory_usage(variable));
+    return rcpp_result_gen;
+END_RCPP
+}
 // variable_update
 void variable_update(Rcpp::XPtr<Variable> variable);
 RcppExport SEXP _individual_variable_update(SEXP variableSEXP) {
@@ -1457,6 +2563,28 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// variable_tombstone
+void variable_tombstone(Rcpp::XPtr<Variable> variable, Rcpp::XPtr<individual_index_t> index);
+RcppExport SEXP _individual_variable_tombstone(SEXP variableSEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<Variable> >::type variable(variableSEXP);
+    Rcpp::traits::input_parameter< Rcpp::XPtr<individual_index_t> >::type index(indexSEXP);
+    variable_tombstone(variable, index);
+    return R_NilValue;
+END_RCPP
+}
+// variables_update_resize
+void variables_update_resize(Rcpp::List variables, size_t threads);
+RcppExport SEXP _individual_variables_update_resize(SEXP variablesSEXP, SEXP threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::List >::type variables(variablesSEXP);
+    Rcpp::traits::input_parameter< size_t >::type threads(threadsSEXP);
+    variables_update_resize(variables, threads);
+    return R_NilValue;
+END_RCPP
+}
 
 // validate (ensure exported C++ functions exist before calling them)
 static int _individual_RcppExport_validate(const char* sig) { 
@@ -1484,6 +2612,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_bitset_clear", (DL_FUNC) &_individual_bitset_clear, 1},
     {"_individual_bitset_size", (DL_FUNC) &_individual_bitset_size, 1},
     {"_individual_bitset_max_size", (DL_FUNC) &_individual_bitset_max_size, 1},
+    {"_individual_bitset_memory_usage", (DL_FUNC) &_individual_bitset_memory_usage, 1},
     {"_individual_bitset_and", (DL_FUNC) &_individual_bitset_and, 2},
     {"_individual_bitset_not", (DL_FUNC) &_individual_bitset_not, 2},
     {"_individual_bitset_or", (DL_FUNC) &_individual_bitset_or, 2},
@@ -1502,6 +2631,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_categorical_variable_queue_update", (DL_FUNC) &_individual_categorical_variable_queue_update, 3},
     {"_individual_categorical_variable_get_index_of", (DL_FUNC) &_individual_categorical_variable_get_index_of, 2},
     {"_individual_categorical_variable_get_size_of", (DL_FUNC) &_individual_categorical_variable_get_size_of, 2},
+    {"_individual_categorical_variable_enable_cache", (DL_FUNC) &_individual_categorical_variable_enable_cache, 1},
     {"_individual_categorical_variable_get_categories", (DL_FUNC) &_individual_categorical_variable_get_categories, 1},
     {"_individual_categorical_variable_queue_update_vector", (DL_FUNC) &_individual_categorical_variable_queue_update_vector, 3},
     {"_individual_categorical_variable_update", (DL_FUNC) &_individual_categorical_variable_update, 1},
@@ -1509,12 +2639,26 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_categorical_variable_queue_shrink", (DL_FUNC) &_individual_categorical_variable_queue_shrink, 2},
     {"_individual_categorical_variable_queue_shrink_bitset", (DL_FUNC) &_individual_categorical_variable_queue_shrink_bitset, 2},
     {"_individual_dummy", (DL_FUNC) &_individual_dummy, 0},
+    {"_individual_crosstab_categorical_internal", (DL_FUNC) &_individual_crosstab_categorical_internal, 2},
+    {"_individual_crosstab_categorical_at_index_internal", (DL_FUNC) &_individual_crosstab_categorical_at_index_internal, 3},
+    {"_individual_crosstab_categorical_integer_internal", (DL_FUNC) &_individual_crosstab_categorical_integer_internal, 3},
+    {"_individual_crosstab_categorical_integer_at_index_internal", (DL_FUNC) &_individual_crosstab_categorical_integer_at_index_internal, 4},
     {"_individual_create_double_variable", (DL_FUNC) &_individual_create_double_variable, 1},
+    {"_individual_create_compact_double_variable", (DL_FUNC) &_individual_create_compact_double_variable, 2},
     {"_individual_double_variable_get_values", (DL_FUNC) &_individual_double_variable_get_values, 1},
     {"_individual_double_variable_get_values_at_index", (DL_FUNC) &_individual_double_variable_get_values_at_index, 2},
     {"_individual_double_variable_get_values_at_index_vector", (DL_FUNC) &_individual_double_variable_get_values_at_index_vector, 2},
     {"_individual_double_variable_get_index_of_range", (DL_FUNC) &_individual_double_variable_get_index_of_range, 3},
     {"_individual_double_variable_get_size_of_range", (DL_FUNC) &_individual_double_variable_get_size_of_range, 3},
+    {"_individual_double_variable_enable_cache", (DL_FUNC) &_individual_double_variable_enable_cache, 1},
+    {"_individual_double_variable_get_summary", (DL_FUNC) &_individual_double_variable_get_summary, 1},
+    {"_individual_double_variable_get_summary_at_index", (DL_FUNC) &_individual_double_variable_get_summary_at_index, 2},
+    {"_individual_double_variable_get_summary_by", (DL_FUNC) &_individual_double_variable_get_summary_by, 2},
+    {"_individual_double_variable_get_summary_by_at_index", (DL_FUNC) &_individual_double_variable_get_summary_by_at_index, 3},
+    {"_individual_double_variable_get_histogram", (DL_FUNC) &_individual_double_variable_get_histogram, 2},
+    {"_individual_double_variable_get_histogram_at_index", (DL_FUNC) &_individual_double_variable_get_histogram_at_index, 3},
+    {"_individual_double_variable_get_quantiles", (DL_FUNC) &_individual_double_variable_get_quantiles, 2},
+    {"_individual_double_variable_get_quantiles_at_index", (DL_FUNC) &_individual_double_variable_get_quantiles_at_index, 3},
     {"_individual_double_variable_queue_fill", (DL_FUNC) &_individual_double_variable_queue_fill, 2},
     {"_individual_double_variable_queue_update", (DL_FUNC) &_individual_double_variable_queue_update, 3},
     {"_individual_double_variable_queue_update_bitset", (DL_FUNC) &_individual_double_variable_queue_update_bitset, 3},
@@ -1527,6 +2671,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_event_base_get_timestep", (DL_FUNC) &_individual_event_base_get_timestep, 1},
     {"_individual_event_base_set_timestep", (DL_FUNC) &_individual_event_base_set_timestep, 2},
     {"_individual_event_base_should_trigger", (DL_FUNC) &_individual_event_base_should_trigger, 1},
+    {"_individual_event_base_memory_usage", (DL_FUNC) &_individual_event_base_memory_usage, 1},
     {"_individual_event_schedule", (DL_FUNC) &_individual_event_schedule, 2},
     {"_individual_event_clear_schedule", (DL_FUNC) &_individual_event_clear_schedule, 1},
     {"_individual_event_checkpoint", (DL_FUNC) &_individual_event_checkpoint, 1},
@@ -1549,6 +2694,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_process_listener", (DL_FUNC) &_individual_process_listener, 2},
     {"_individual_process_targeted_listener", (DL_FUNC) &_individual_process_targeted_listener, 3},
     {"_individual_create_integer_variable", (DL_FUNC) &_individual_create_integer_variable, 1},
+    {"_individual_create_compact_integer_variable", (DL_FUNC) &_individual_create_compact_integer_variable, 2},
     {"_individual_integer_variable_get_values", (DL_FUNC) &_individual_integer_variable_get_values, 1},
     {"_individual_integer_variable_get_values_at_index", (DL_FUNC) &_individual_integer_variable_get_values_at_index, 2},
     {"_individual_integer_variable_get_values_at_index_vector", (DL_FUNC) &_individual_integer_variable_get_values_at_index_vector, 2},
@@ -1558,49 +2704,126 @@ static const R_CallMethodDef CallEntries[] = {
     {"_individual_integer_variable_get_size_of_set_vector", (DL_FUNC) &_individual_integer_variable_get_size_of_set_vector, 2},
     {"_individual_integer_variable_get_size_of_set_scalar", (DL_FUNC) &_individual_integer_variable_get_size_of_set_scalar, 2},
     {"_individual_integer_variable_get_size_of_range", (DL_FUNC) &_individual_integer_variable_get_size_of_range, 3},
+    {"_individual_integer_variable_enable_cache", (DL_FUNC) &_individual_integer_variable_enable_cache, 1},
+    {"_individual_integer_variable_get_summary", (DL_FUNC) &_individual_integer_variable_get_summary, 1},
+    {"_individual_integer_variable_get_summary_at_index", (DL_FUNC) &_individual_integer_variable_get_summary_at_index, 2},
+    {"_individual_integer_variable_get_summary_by", (DL_FUNC) &_individual_integer_variable_get_summary_by, 2},
+    {"_individual_integer_variable_get_summary_by_at_index", (DL_FUNC) &_individual_integer_variable_get_summary_by_at_index, 3},
+    {"_individual_integer_variable_get_histogram", (DL_FUNC) &_individual_integer_variable_get_histogram, 2},
+    {"_individual_integer_variable_get_histogram_at_index", (DL_FUNC) &_individual_integer_variable_get_histogram_at_index, 3},
+    {"_individual_integer_variable_get_quantiles", (DL_FUNC) &_individual_integer_variable_get_quantiles, 2},
+    {"_individual_integer_variable_get_quantiles_at_index", (DL_FUNC) &_individual_integer_variable_get_quantiles_at_index, 3},
     {"_individual_integer_variable_queue_fill", (DL_FUNC) &_individual_integer_variable_queue_fill, 2},
     {"_individual_integer_variable_queue_update", (DL_FUNC) &_individual_integer_variable_queue_update, 3},
     {"_individual_integer_variable_queue_update_bitset", (DL_FUNC) &_individual_integer_variable_queue_update_bitset, 3},
     {"_individual_integer_variable_queue_extend", (DL_FUNC) &_individual_integer_variable_queue_extend, 2},
     {"_individual_integer_variable_queue_shrink", (DL_FUNC) &_individual_integer_variable_queue_shrink, 2},
     {"_individual_integer_variable_queue_shrink_bitset", (DL_FUNC) &_individual_integer_variable_queue_shrink_bitset, 2},
+    {"_individual_create_memory_report", (DL_FUNC) &_individual_create_memory_report, 1},
+    {"_individual_memory_report_should_report", (DL_FUNC) &_individual_memory_report_should_report, 2},
+    {"_individual_memory_report_record", (DL_FUNC) &_individual_memory_report_record, 5},
+    {"_individual_memory_report_data", (DL_FUNC) &_individual_memory_report_data, 1},
+    {"_individual_create_population", (DL_FUNC) &_individual_create_population, 2},
+    {"_individual_population_get_alive", (DL_FUNC) &_individual_population_get_alive, 1},
+    {"_individual_population_get_free", (DL_FUNC) &_individual_population_get_free, 1},
+    {"_individual_population_filter", (DL_FUNC) &_individual_population_filter, 2},
+    {"_individual_population_memory_usage", (DL_FUNC) &_individual_population_memory_usage, 1},
+    {"_individual_population_get_size", (DL_FUNC) &_individual_population_get_size, 1},
+    {"_individual_population_get_capacity", (DL_FUNC) &_individual_population_get_capacity, 1},
+    {"_individual_population_queue_shrink", (DL_FUNC) &_individual_population_queue_shrink, 2},
+    {"_individual_population_queue_shrink_bitset", (DL_FUNC) &_individual_population_queue_shrink_bitset, 2},
+    {"_individual_population_queue_extend", (DL_FUNC) &_individual_population_queue_extend, 2},
+    {"_individual_population_resize", (DL_FUNC) &_individual_population_resize, 1},
+    {"_individual_population_should_compact", (DL_FUNC) &_individual_population_should_compact, 1},
+    {"_individual_population_compact", (DL_FUNC) &_individual_population_compact, 1},
+    {"_individual_population_restore", (DL_FUNC) &_individual_population_restore, 2},
     {"_individual_fixed_probability_multinomial_process_internal", (DL_FUNC) &_individual_fixed_probability_multinomial_process_internal, 5},
     {"_individual_multi_probability_multinomial_process_internal", (DL_FUNC) &_individual_multi_probability_multinomial_process_internal, 5},
     {"_individual_multi_probability_bernoulli_process_internal", (DL_FUNC) &_individual_multi_probability_bernoulli_process_internal, 4},
     {"_individual_infection_age_process_internal", (DL_FUNC) &_individual_infection_age_process_internal, 9},
+    {"_individual_categorical_count_renderer_process_internal", (DL_FUNC) &_individual_categorical_count_renderer_process_internal, 3},
+    {"_individual_create_profiler", (DL_FUNC) &_individual_create_profiler, 0},
+    {"_individual_profiler_now", (DL_FUNC) &_individual_profiler_now, 0},
+    {"_individual_profiler_record", (DL_FUNC) &_individual_profiler_record, 5},
+    {"_individual_profiler_data", (DL_FUNC) &_individual_profiler_data, 1},
+    {"_individual_create_query", (DL_FUNC) &_individual_create_query, 0},
+    {"_individual_query_add_categorical", (DL_FUNC) &_individual_query_add_categorical, 3},
+    {"_individual_query_add_integer_set", (DL_FUNC) &_individual_query_add_integer_set, 3},
+    {"_individual_query_add_integer_range", (DL_FUNC) &_individual_query_add_integer_range, 4},
+    {"_individual_query_add_double_range", (DL_FUNC) &_individual_query_add_double_range, 4},
+    {"_individual_query_evaluate", (DL_FUNC) &_individual_query_evaluate, 1},
+    {"_individual_query_evaluate_within", (DL_FUNC) &_individual_query_evaluate_within, 2},
     {"_individual_create_double_ragged_variable", (DL_FUNC) &_individual_create_double_ragged_variable, 1},
+    {"_individual_create_flat_double_ragged_variable", (DL_FUNC) &_individual_create_flat_double_ragged_variable, 1},
     {"_individual_double_ragged_variable_get_values", (DL_FUNC) &_individual_double_ragged_variable_get_values, 1},
     {"_individual_double_ragged_variable_get_values_at_index_bitset", (DL_FUNC) &_individual_double_ragged_variable_get_values_at_index_bitset, 2},
     {"_individual_double_ragged_variable_get_values_at_index_vector", (DL_FUNC) &_individual_double_ragged_variable_get_values_at_index_vector, 2},
+    {"_individual_double_ragged_variable_get_index_of_contains", (DL_FUNC) &_individual_double_ragged_variable_get_index_of_contains, 2},
     {"_individual_double_ragged_variable_get_length", (DL_FUNC) &_individual_double_ragged_variable_get_length, 1},
     {"_individual_double_ragged_variable_get_length_at_index_bitset", (DL_FUNC) &_individual_double_ragged_variable_get_length_at_index_bitset, 2},
     {"_individual_double_ragged_variable_get_length_at_index_vector", (DL_FUNC) &_individual_double_ragged_variable_get_length_at_index_vector, 2},
     {"_individual_double_ragged_variable_queue_fill", (DL_FUNC) &_individual_double_ragged_variable_queue_fill, 2},
     {"_individual_double_ragged_variable_queue_update", (DL_FUNC) &_individual_double_ragged_variable_queue_update, 3},
     {"_individual_double_ragged_variable_queue_update_bitset", (DL_FUNC) &_individual_double_ragged_variable_queue_update_bitset, 3},
+    {"_individual_double_ragged_variable_queue_push_back", (DL_FUNC) &_individual_double_ragged_variable_queue_push_back, 3},
+    {"_individual_double_ragged_variable_queue_remove", (DL_FUNC) &_individual_double_ragged_variable_queue_remove, 3},
+    {"_individual_double_ragged_variable_queue_remove_range", (DL_FUNC) &_individual_double_ragged_variable_queue_remove_range, 4},
+    {"_individual_double_ragged_variable_queue_truncate", (DL_FUNC) &_individual_double_ragged_variable_queue_truncate, 3},
     {"_individual_double_ragged_variable_queue_extend", (DL_FUNC) &_individual_double_ragged_variable_queue_extend, 2},
     {"_individual_double_ragged_variable_queue_shrink", (DL_FUNC) &_individual_double_ragged_variable_queue_shrink, 2},
     {"_individual_double_ragged_variable_queue_shrink_bitset", (DL_FUNC) &_individual_double_ragged_variable_queue_shrink_bitset, 2},
     {"_individual_create_integer_ragged_variable", (DL_FUNC) &_individual_create_integer_ragged_variable, 1},
+    {"_individual_create_flat_integer_ragged_variable", (DL_FUNC) &_individual_create_flat_integer_ragged_variable, 1},
     {"_individual_integer_ragged_variable_get_values", (DL_FUNC) &_individual_integer_ragged_variable_get_values, 1},
     {"_individual_integer_ragged_variable_get_values_at_index_bitset", (DL_FUNC) &_individual_integer_ragged_variable_get_values_at_index_bitset, 2},
     {"_individual_integer_ragged_variable_get_values_at_index_vector", (DL_FUNC) &_individual_integer_ragged_variable_get_values_at_index_vector, 2},
+    {"_individual_integer_ragged_variable_get_index_of_contains", (DL_FUNC) &_individual_integer_ragged_variable_get_index_of_contains, 2},
+    {"_individual_integer_ragged_variable_enable_inverted_index", (DL_FUNC) &_individual_integer_ragged_variable_enable_inverted_index, 1},
     {"_individual_integer_ragged_variable_get_length", (DL_FUNC) &_individual_integer_ragged_variable_get_length, 1},
     {"_individual_integer_ragged_variable_get_length_at_index_bitset", (DL_FUNC) &_individual_integer_ragged_variable_get_length_at_index_bitset, 2},
     {"_individual_integer_ragged_variable_get_length_at_index_vector", (DL_FUNC) &_individual_integer_ragged_variable_get_length_at_index_vector, 2},
     {"_individual_integer_ragged_variable_queue_fill", (DL_FUNC) &_individual_integer_ragged_variable_queue_fill, 2},
     {"_individual_integer_ragged_variable_queue_update", (DL_FUNC) &_individual_integer_ragged_variable_queue_update, 3},
     {"_individual_integer_ragged_variable_queue_update_bitset", (DL_FUNC) &_individual_integer_ragged_variable_queue_update_bitset, 3},
+    {"_individual_integer_ragged_variable_queue_push_back", (DL_FUNC) &_individual_integer_ragged_variable_queue_push_back, 3},
+    {"_individual_integer_ragged_variable_queue_remove", (DL_FUNC) &_individual_integer_ragged_variable_queue_remove, 3},
+    {"_individual_integer_ragged_variable_queue_remove_range", (DL_FUNC) &_individual_integer_ragged_variable_queue_remove_range, 4},
+    {"_individual_integer_ragged_variable_queue_truncate", (DL_FUNC) &_individual_integer_ragged_variable_queue_truncate, 3},
     {"_individual_integer_ragged_variable_queue_extend", (DL_FUNC) &_individual_integer_ragged_variable_queue_extend, 2},
     {"_individual_integer_ragged_variable_queue_shrink", (DL_FUNC) &_individual_integer_ragged_variable_queue_shrink, 2},
     {"_individual_integer_ragged_variable_queue_shrink_bitset", (DL_FUNC) &_individual_integer_ragged_variable_queue_shrink_bitset, 2},
     {"_individual_create_render_vector", (DL_FUNC) &_individual_create_render_vector, 1},
     {"_individual_render_vector_update", (DL_FUNC) &_individual_render_vector_update, 3},
     {"_individual_render_vector_data", (DL_FUNC) &_individual_render_vector_data, 1},
+    {"_individual_create_resize_coordinator", (DL_FUNC) &_individual_create_resize_coordinator, 3},
+    {"_individual_resize_coordinator_add_variable", (DL_FUNC) &_individual_resize_coordinator_add_variable, 2},
+    {"_individual_resize_coordinator_add_event", (DL_FUNC) &_individual_resize_coordinator_add_event, 2},
+    {"_individual_resize_coordinator_queue_shrink_bitset", (DL_FUNC) &_individual_resize_coordinator_queue_shrink_bitset, 2},
+    {"_individual_resize_coordinator_has_queued_shrink", (DL_FUNC) &_individual_resize_coordinator_has_queued_shrink, 1},
+    {"_individual_resize_coordinator_tombstone", (DL_FUNC) &_individual_resize_coordinator_tombstone, 2},
+    {"_individual_resize_coordinator_resize", (DL_FUNC) &_individual_resize_coordinator_resize, 1},
+    {"_individual_resize_coordinator_remap", (DL_FUNC) &_individual_resize_coordinator_remap, 2},
+    {"_individual_resize_coordinator_remap_bitset", (DL_FUNC) &_individual_resize_coordinator_remap_bitset, 2},
     {"_individual_execute_process", (DL_FUNC) &_individual_execute_process, 2},
+    {"_individual_execute_simulation", (DL_FUNC) &_individual_execute_simulation, 14},
+    {"_individual_execute_ensemble", (DL_FUNC) &_individual_execute_ensemble, 5},
+    {"_individual_create_time_variable", (DL_FUNC) &_individual_create_time_variable, 2},
+    {"_individual_time_variable_get_values", (DL_FUNC) &_individual_time_variable_get_values, 2},
+    {"_individual_time_variable_get_values_at_index", (DL_FUNC) &_individual_time_variable_get_values_at_index, 3},
+    {"_individual_time_variable_get_values_at_index_vector", (DL_FUNC) &_individual_time_variable_get_values_at_index_vector, 3},
+    {"_individual_time_variable_get_index_of_set", (DL_FUNC) &_individual_time_variable_get_index_of_set, 3},
+    {"_individual_time_variable_get_index_of_range", (DL_FUNC) &_individual_time_variable_get_index_of_range, 4},
+    {"_individual_time_variable_get_size_of_set", (DL_FUNC) &_individual_time_variable_get_size_of_set, 3},
+    {"_individual_time_variable_get_size_of_range", (DL_FUNC) &_individual_time_variable_get_size_of_range, 4},
+    {"_individual_trace_start", (DL_FUNC) &_individual_trace_start, 1},
+    {"_individual_trace_active", (DL_FUNC) &_individual_trace_active, 0},
+    {"_individual_trace_stop", (DL_FUNC) &_individual_trace_stop, 1},
     {"_individual_variable_get_size", (DL_FUNC) &_individual_variable_get_size, 1},
+    {"_individual_variable_memory_usage", (DL_FUNC) &_individual_variable_memory_usage, 1},
     {"_individual_variable_update", (DL_FUNC) &_individual_variable_update, 1},
     {"_individual_variable_resize", (DL_FUNC) &_individual_variable_resize, 1},
+    {"_individual_variable_tombstone", (DL_FUNC) &_individual_variable_tombstone, 2},
+    {"_individual_variables_update_resize", (DL_FUNC) &_individual_variables_update_resize, 2},
     {"_individual_RcppExport_registerCCallable", (DL_FUNC) &_individual_RcppExport_registerCCallable, 0},
     {"run_testthat_tests", (DL_FUNC) &run_testthat_tests, 1},
     {NULL, NULL, 0}
@@ -57,6 +57,11 @@ size_t bitset_max_size(const Rcpp::XPtr<individual_index_t> b) {
     return b->max_size();
 }
 
+//[[Rcpp::export]]
+double bitset_memory_usage(const Rcpp::XPtr<individual_index_t> b) {
+    return static_cast<double>(b->memory_usage());
+}
+
 //[[Rcpp::export]]
 void bitset_and(
     const Rcpp::XPtr<individual_index_t> a,
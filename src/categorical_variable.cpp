@@ -41,6 +41,12 @@ Rcpp::XPtr<individual_index_t> categorical_variable_get_index_of(
     Rcpp::XPtr<CategoricalVariable> variable,
     const std::vector<std::string>& values 
     ) {
+    if (variable->is_cache_enabled()) {
+        return Rcpp::XPtr<individual_index_t>(
+            new individual_index_t(variable->get_index_of_cached(values)),
+            true
+        );
+    }
     return Rcpp::XPtr<individual_index_t>(
         new individual_index_t(variable->get_index_of(values)),
         true
@@ -55,6 +61,13 @@ int categorical_variable_get_size_of(
     return variable->get_size_of(values);
 }
 
+//[[Rcpp::export]]
+void categorical_variable_enable_cache(
+    Rcpp::XPtr<CategoricalVariable> variable
+    ) {
+    variable->enable_cache();
+}
+
 //[[Rcpp::export]]
 std::vector<std::string> categorical_variable_get_categories(
     Rcpp::XPtr<CategoricalVariable> variable
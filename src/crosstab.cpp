@@ -0,0 +1,70 @@
+/*
+ * crosstab.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/crosstab.h"
+#include "utils.h"
+
+inline Rcpp::NumericMatrix counts_to_matrix(
+    const std::vector<size_t>& counts,
+    const size_t nrow,
+    const size_t ncol
+) {
+    auto result = Rcpp::NumericMatrix(nrow, ncol);
+    std::copy(counts.cbegin(), counts.cend(), result.begin());
+    return result;
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix crosstab_categorical_internal(
+    Rcpp::XPtr<CategoricalVariable> a,
+    Rcpp::XPtr<CategoricalVariable> b
+) {
+    return counts_to_matrix(
+        crosstab_categorical(*a, *b, nullptr),
+        a->get_categories().size(),
+        b->get_categories().size()
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix crosstab_categorical_at_index_internal(
+    Rcpp::XPtr<CategoricalVariable> a,
+    Rcpp::XPtr<CategoricalVariable> b,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return counts_to_matrix(
+        crosstab_categorical(*a, *b, &(*index)),
+        a->get_categories().size(),
+        b->get_categories().size()
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix crosstab_categorical_integer_internal(
+    Rcpp::XPtr<CategoricalVariable> a,
+    Rcpp::XPtr<IntegerVariable> b,
+    const std::vector<int>& levels
+) {
+    return counts_to_matrix(
+        crosstab_categorical_integer(*a, *b, levels, nullptr),
+        a->get_categories().size(),
+        levels.size()
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix crosstab_categorical_integer_at_index_internal(
+    Rcpp::XPtr<CategoricalVariable> a,
+    Rcpp::XPtr<IntegerVariable> b,
+    const std::vector<int>& levels,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return counts_to_matrix(
+        crosstab_categorical_integer(*a, *b, levels, &(*index)),
+        a->get_categories().size(),
+        levels.size()
+    );
+}
@@ -7,6 +7,7 @@
 
 
 #include "../inst/include/DoubleVariable.h"
+#include "../inst/include/CompactVariable.h"
 #include "utils.h"
 
 //[[Rcpp::export]]
@@ -20,7 +21,21 @@ Rcpp::XPtr<DoubleVariable> create_double_variable(
 }
 
 //[[Rcpp::export]]
-const std::vector<double>& double_variable_get_values(
+Rcpp::XPtr<DoubleVariable> create_compact_double_variable(
+    const std::vector<double>& values,
+    const std::string storage
+    ) {
+    if (storage != "float") {
+        Rcpp::stop("unknown storage type for DoubleVariable: " + storage);
+    }
+    return Rcpp::XPtr<DoubleVariable>(
+        new CompactDoubleVariable<float>(values),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+std::vector<double> double_variable_get_values(
     Rcpp::XPtr<DoubleVariable> variable
     ) {
     return variable->get_values();
@@ -49,6 +64,12 @@ Rcpp::XPtr<individual_index_t> double_variable_get_index_of_range(
     const double a,
     const double b
 ) {
+    if (variable->is_cache_enabled()) {
+        return Rcpp::XPtr<individual_index_t>(
+            new individual_index_t(variable->get_index_of_range_cached(a, b)),
+            true
+        );
+    }
     return Rcpp::XPtr<individual_index_t>(
         new individual_index_t(variable->get_index_of_range(a, b)),
         true
@@ -61,9 +82,91 @@ size_t double_variable_get_size_of_range(
     const double a,
     const double b
 ) {
+    if (variable->is_cache_enabled()) {
+        return variable->get_size_of_range_cached(a, b);
+    }
     return variable->get_size_of_range(a, b);
 }
 
+// [[Rcpp::export]]
+void double_variable_enable_cache(
+    Rcpp::XPtr<DoubleVariable> variable
+) {
+    variable->enable_cache();
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector double_variable_get_summary(
+    Rcpp::XPtr<DoubleVariable> variable
+) {
+    return summary_to_vector(variable->get_summary());
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector double_variable_get_summary_at_index(
+    Rcpp::XPtr<DoubleVariable> variable,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return summary_to_vector(variable->get_summary(*index));
+}
+
+// [[Rcpp::export]]
+Rcpp::DataFrame double_variable_get_summary_by(
+    Rcpp::XPtr<DoubleVariable> variable,
+    Rcpp::XPtr<CategoricalVariable> group
+) {
+    return summaries_to_data_frame(
+        group->get_categories(),
+        variable->get_summary_by(*group)
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::DataFrame double_variable_get_summary_by_at_index(
+    Rcpp::XPtr<DoubleVariable> variable,
+    Rcpp::XPtr<CategoricalVariable> group,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return summaries_to_data_frame(
+        group->get_categories(),
+        variable->get_summary_by(*group, *index)
+    );
+}
+
+// [[Rcpp::export]]
+std::vector<size_t> double_variable_get_histogram(
+    Rcpp::XPtr<DoubleVariable> variable,
+    const std::vector<double>& breaks
+) {
+    return variable->get_histogram(breaks);
+}
+
+// [[Rcpp::export]]
+std::vector<size_t> double_variable_get_histogram_at_index(
+    Rcpp::XPtr<DoubleVariable> variable,
+    const std::vector<double>& breaks,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return variable->get_histogram(breaks, *index);
+}
+
+// [[Rcpp::export]]
+std::vector<double> double_variable_get_quantiles(
+    Rcpp::XPtr<DoubleVariable> variable,
+    const std::vector<double>& probs
+) {
+    return variable->get_quantiles(probs);
+}
+
+// [[Rcpp::export]]
+std::vector<double> double_variable_get_quantiles_at_index(
+    Rcpp::XPtr<DoubleVariable> variable,
+    const std::vector<double>& probs,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return variable->get_quantiles(probs, *index);
+}
+
 //[[Rcpp::export]]
 void double_variable_queue_fill(
     Rcpp::XPtr<DoubleVariable> variable,
@@ -91,8 +194,7 @@ void double_variable_queue_update_bitset(
     if (index->max_size() != variable->size()) {
         Rcpp::stop("incompatible size bitset used to queue update for DoubleVariable");
     }
-    auto index_vec = bitset_to_vector_internal(*index, false);
-    variable->queue_update(std::move(value), std::move(index_vec));
+    variable->queue_update(std::move(value), *index);
 }
 
 //[[Rcpp::export]]
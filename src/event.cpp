@@ -38,6 +38,11 @@ bool event_base_should_trigger(const Rcpp::XPtr<EventBase> event) {
     return event->should_trigger();
 }
 
+//[[Rcpp::export]]
+Rcpp::NumericVector event_base_memory_usage(const Rcpp::XPtr<EventBase> event) {
+    return memory_usage_to_vector(event->memory_usage());
+}
+
 //[[Rcpp::export]]
 void event_schedule(const Rcpp::XPtr<Event> event, std::vector<double> delays) {
     event->schedule(delays);
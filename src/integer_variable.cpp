@@ -7,6 +7,7 @@
 
 
 #include "../inst/include/IntegerVariable.h"
+#include "../inst/include/CompactVariable.h"
 #include "utils.h"
 
 //[[Rcpp::export]]
@@ -20,7 +21,27 @@ Rcpp::XPtr<IntegerVariable> create_integer_variable(
 }
 
 //[[Rcpp::export]]
-const std::vector<int>& integer_variable_get_values(
+Rcpp::XPtr<IntegerVariable> create_compact_integer_variable(
+    const std::vector<int>& values,
+    const std::string storage
+    ) {
+    IntegerVariable* variable;
+    if (storage == "int8") {
+        variable = new CompactIntegerVariable<int8_t>(values);
+    } else if (storage == "uint8") {
+        variable = new CompactIntegerVariable<uint8_t>(values);
+    } else if (storage == "int16") {
+        variable = new CompactIntegerVariable<int16_t>(values);
+    } else if (storage == "uint16") {
+        variable = new CompactIntegerVariable<uint16_t>(values);
+    } else {
+        Rcpp::stop("unknown storage type for IntegerVariable: " + storage);
+    }
+    return Rcpp::XPtr<IntegerVariable>(variable, true);
+}
+
+//[[Rcpp::export]]
+std::vector<int> integer_variable_get_values(
     Rcpp::XPtr<IntegerVariable> variable
     ) {
     return variable->get_values();
@@ -48,6 +69,12 @@ Rcpp::XPtr<individual_index_t> integer_variable_get_index_of_set_vector(
     Rcpp::XPtr<IntegerVariable> variable,
     std::vector<int> values_set
 ) {
+    if (variable->is_cache_enabled()) {
+        return Rcpp::XPtr<individual_index_t>(
+            new individual_index_t(variable->get_index_of_set_cached(values_set)),
+            true
+        );
+    }
     return Rcpp::XPtr<individual_index_t>(
         new individual_index_t(variable->get_index_of_set(values_set)),
         true
@@ -59,6 +86,12 @@ Rcpp::XPtr<individual_index_t> integer_variable_get_index_of_set_scalar(
         Rcpp::XPtr<IntegerVariable> variable,
         const int values_set
 ) {
+    if (variable->is_cache_enabled()) {
+        return Rcpp::XPtr<individual_index_t>(
+            new individual_index_t(variable->get_index_of_set_cached({values_set})),
+            true
+        );
+    }
     return Rcpp::XPtr<individual_index_t>(
         new individual_index_t(variable->get_index_of_set(values_set)),
         true
@@ -71,6 +104,12 @@ Rcpp::XPtr<individual_index_t> integer_variable_get_index_of_range(
     const int a,
     const int b
 ) {
+    if (variable->is_cache_enabled()) {
+        return Rcpp::XPtr<individual_index_t>(
+            new individual_index_t(variable->get_index_of_range_cached(a, b)),
+            true
+        );
+    }
     return Rcpp::XPtr<individual_index_t>(
         new individual_index_t(variable->get_index_of_range(a, b)),
         true
@@ -82,6 +121,9 @@ size_t integer_variable_get_size_of_set_vector(
     Rcpp::XPtr<IntegerVariable> variable,
     const std::vector<int> values_set
 ) {
+    if (variable->is_cache_enabled()) {
+        return variable->get_size_of_set_cached(values_set);
+    }
     return variable->get_size_of_set(values_set);
 }
 
@@ -90,6 +132,9 @@ size_t integer_variable_get_size_of_set_scalar(
         Rcpp::XPtr<IntegerVariable> variable,
         const int value
 ) {
+    if (variable->is_cache_enabled()) {
+        return variable->get_size_of_set_cached({value});
+    }
     return variable->get_size_of_set(value);
 }
 
@@ -99,10 +144,92 @@ size_t integer_variable_get_size_of_range(
     const int a,
     const int b
 ) {
+    if (variable->is_cache_enabled()) {
+        return variable->get_size_of_range_cached(a, b);
+    }
     return variable->get_size_of_range(a, b);
 }
 
 
+// [[Rcpp::export]]
+void integer_variable_enable_cache(
+    Rcpp::XPtr<IntegerVariable> variable
+) {
+    variable->enable_cache();
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector integer_variable_get_summary(
+    Rcpp::XPtr<IntegerVariable> variable
+) {
+    return summary_to_vector(variable->get_summary());
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector integer_variable_get_summary_at_index(
+    Rcpp::XPtr<IntegerVariable> variable,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return summary_to_vector(variable->get_summary(*index));
+}
+
+// [[Rcpp::export]]
+Rcpp::DataFrame integer_variable_get_summary_by(
+    Rcpp::XPtr<IntegerVariable> variable,
+    Rcpp::XPtr<CategoricalVariable> group
+) {
+    return summaries_to_data_frame(
+        group->get_categories(),
+        variable->get_summary_by(*group)
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::DataFrame integer_variable_get_summary_by_at_index(
+    Rcpp::XPtr<IntegerVariable> variable,
+    Rcpp::XPtr<CategoricalVariable> group,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return summaries_to_data_frame(
+        group->get_categories(),
+        variable->get_summary_by(*group, *index)
+    );
+}
+
+// [[Rcpp::export]]
+std::vector<size_t> integer_variable_get_histogram(
+    Rcpp::XPtr<IntegerVariable> variable,
+    const std::vector<double>& breaks
+) {
+    return variable->get_histogram(breaks);
+}
+
+// [[Rcpp::export]]
+std::vector<size_t> integer_variable_get_histogram_at_index(
+    Rcpp::XPtr<IntegerVariable> variable,
+    const std::vector<double>& breaks,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return variable->get_histogram(breaks, *index);
+}
+
+// [[Rcpp::export]]
+std::vector<double> integer_variable_get_quantiles(
+    Rcpp::XPtr<IntegerVariable> variable,
+    const std::vector<double>& probs
+) {
+    return variable->get_quantiles(probs);
+}
+
+// [[Rcpp::export]]
+std::vector<double> integer_variable_get_quantiles_at_index(
+    Rcpp::XPtr<IntegerVariable> variable,
+    const std::vector<double>& probs,
+    Rcpp::XPtr<individual_index_t> index
+) {
+    return variable->get_quantiles(probs, *index);
+}
+
 //[[Rcpp::export]]
 void integer_variable_queue_fill(
     Rcpp::XPtr<IntegerVariable> variable,
@@ -127,8 +254,7 @@ void integer_variable_queue_update_bitset(
         std::vector<int> value,
         Rcpp::XPtr<individual_index_t> index
 ) {
-    auto index_vec = bitset_to_vector_internal(*index, false);
-    variable->queue_update(std::move(value), std::move(index_vec));
+    variable->queue_update(std::move(value), *index);
 }
 
 //[[Rcpp::export]]
@@ -0,0 +1,51 @@
+/*
+ * memory_report.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/memory_usage.h"
+#include "utils.h"
+#include <Rcpp.h>
+
+//[[Rcpp::export]]
+Rcpp::XPtr<MemoryReport> create_memory_report(size_t every) {
+    return Rcpp::XPtr<MemoryReport>(new MemoryReport(every), true);
+}
+
+//[[Rcpp::export]]
+bool memory_report_should_report(Rcpp::XPtr<MemoryReport> report, size_t timestep) {
+    return report->should_report(timestep);
+}
+
+//[[Rcpp::export]]
+void memory_report_record(
+    Rcpp::XPtr<MemoryReport> report,
+    size_t timestep,
+    const std::string kind,
+    const std::string name,
+    Rcpp::NumericVector usage
+    ) {
+    report->record(timestep, kind, name, vector_to_memory_usage(usage));
+}
+
+//[[Rcpp::export]]
+Rcpp::List memory_report_data(Rcpp::XPtr<MemoryReport> report) {
+    const auto& usages = report->get_usages();
+    auto storage = Rcpp::NumericVector(usages.size());
+    auto updates = Rcpp::NumericVector(usages.size());
+    auto resizes = Rcpp::NumericVector(usages.size());
+    for (auto i = 0u; i < usages.size(); ++i) {
+        storage[i] = static_cast<double>(usages[i].storage);
+        updates[i] = static_cast<double>(usages[i].updates);
+        resizes[i] = static_cast<double>(usages[i].resizes);
+    }
+    return Rcpp::List::create(
+        Rcpp::Named("timestep") = report->get_timesteps(),
+        Rcpp::Named("kind") = report->get_kinds(),
+        Rcpp::Named("name") = report->get_names(),
+        Rcpp::Named("storage") = storage,
+        Rcpp::Named("updates") = updates,
+        Rcpp::Named("resizes") = resizes
+    );
+}
@@ -0,0 +1,122 @@
+/*
+ * population.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/Population.h"
+#include "utils.h"
+
+//[[Rcpp::export]]
+Rcpp::XPtr<Population> create_population(
+    size_t size,
+    double compaction_threshold
+    ) {
+    return Rcpp::XPtr<Population>(
+        new Population(size, compaction_threshold),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> population_get_alive(
+    Rcpp::XPtr<Population> population
+    ) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(population->get_alive()),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> population_get_free(
+    Rcpp::XPtr<Population> population
+    ) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(population->get_free()),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+void population_filter(
+    Rcpp::XPtr<Population> population,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    if (index->max_size() != population->capacity()) {
+        Rcpp::stop("incompatible size bitset used to filter a population");
+    }
+    *index &= population->get_alive();
+}
+
+//[[Rcpp::export]]
+Rcpp::NumericVector population_memory_usage(Rcpp::XPtr<Population> population) {
+    return memory_usage_to_vector(population->memory_usage());
+}
+
+//[[Rcpp::export]]
+size_t population_get_size(Rcpp::XPtr<Population> population) {
+    return population->size();
+}
+
+//[[Rcpp::export]]
+size_t population_get_capacity(Rcpp::XPtr<Population> population) {
+    return population->capacity();
+}
+
+//[[Rcpp::export]]
+void population_queue_shrink(
+    Rcpp::XPtr<Population> population,
+    std::vector<size_t>& index
+    ) {
+    decrement(index);
+    population->queue_shrink(index);
+}
+
+//[[Rcpp::export]]
+void population_queue_shrink_bitset(
+    Rcpp::XPtr<Population> population,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    population->queue_shrink(*index);
+}
+
+//[[Rcpp::export]]
+std::vector<size_t> population_queue_extend(
+    Rcpp::XPtr<Population> population,
+    size_t n
+    ) {
+    auto slots = population->queue_extend(n);
+    for (auto& slot : slots) {
+        ++slot;
+    }
+    return slots;
+}
+
+//[[Rcpp::export]]
+void population_resize(Rcpp::XPtr<Population> population) {
+    population->resize();
+}
+
+//[[Rcpp::export]]
+bool population_should_compact(Rcpp::XPtr<Population> population) {
+    return population->should_compact();
+}
+
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> population_compact(
+    Rcpp::XPtr<Population> population
+    ) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(population->compact()),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+void population_restore(
+    Rcpp::XPtr<Population> population,
+    Rcpp::XPtr<individual_index_t> alive
+    ) {
+    population->restore(*alive);
+}
@@ -0,0 +1,61 @@
+/*
+ * profiler.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/Profiler.h"
+#include "../inst/include/Trace.h"
+#include <Rcpp.h>
+
+//[[Rcpp::export]]
+Rcpp::XPtr<Profiler> create_profiler() {
+    return Rcpp::XPtr<Profiler>(new Profiler(), true);
+}
+
+//[[Rcpp::export]]
+double profiler_now() {
+    return std::chrono::duration<double>(
+        profile_clock_t::now().time_since_epoch()
+    ).count();
+}
+
+//[[Rcpp::export]]
+void profiler_record(
+    Rcpp::XPtr<Profiler> profiler,
+    size_t timestep,
+    const std::string kind,
+    const std::string name,
+    double start
+    ) {
+    const auto end = profiler_now();
+    profiler->record(timestep, profiler->add_phase(kind, name), end - start);
+    // phases of the R simulation loop are traced as they are profiled
+    const auto recorder = trace_recorder().load();
+    if (recorder != nullptr) {
+        const auto time_point = [](double seconds) {
+            return profile_clock_t::time_point(
+                std::chrono::duration_cast<profile_clock_t::duration>(
+                    std::chrono::duration<double>(seconds)
+                )
+            );
+        };
+        recorder->record(
+            recorder->intern(name),
+            recorder->intern(kind),
+            time_point(start),
+            time_point(end),
+            timestep
+        );
+    }
+}
+
+//[[Rcpp::export]]
+Rcpp::List profiler_data(Rcpp::XPtr<Profiler> profiler) {
+    return Rcpp::List::create(
+        Rcpp::Named("timestep") = profiler->get_timesteps(),
+        Rcpp::Named("phase") = profiler->get_kinds(),
+        Rcpp::Named("name") = profiler->get_names(),
+        Rcpp::Named("seconds") = profiler->get_seconds()
+    );
+}
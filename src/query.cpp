@@ -0,0 +1,72 @@
+/*
+ * query.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/Query.h"
+#include "utils.h"
+
+// [[Rcpp::export]]
+Rcpp::XPtr<Query> create_query() {
+    return Rcpp::XPtr<Query>(new Query(), true);
+}
+
+// [[Rcpp::export]]
+void query_add_categorical(
+    Rcpp::XPtr<Query> query,
+    Rcpp::XPtr<CategoricalVariable> variable,
+    const std::vector<std::string>& categories
+) {
+    query->add_categorical(*variable, categories);
+}
+
+// [[Rcpp::export]]
+void query_add_integer_set(
+    Rcpp::XPtr<Query> query,
+    Rcpp::XPtr<IntegerVariable> variable,
+    const std::vector<int>& set
+) {
+    query->add_set(*variable, set);
+}
+
+// [[Rcpp::export]]
+void query_add_integer_range(
+    Rcpp::XPtr<Query> query,
+    Rcpp::XPtr<IntegerVariable> variable,
+    const int a,
+    const int b
+) {
+    query->add_range(*variable, a, b);
+}
+
+// [[Rcpp::export]]
+void query_add_double_range(
+    Rcpp::XPtr<Query> query,
+    Rcpp::XPtr<DoubleVariable> variable,
+    const double a,
+    const double b
+) {
+    query->add_range(*variable, a, b);
+}
+
+// [[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> query_evaluate(
+    Rcpp::XPtr<Query> query
+) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(query->evaluate()),
+        true
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> query_evaluate_within(
+    Rcpp::XPtr<Query> query,
+    Rcpp::XPtr<individual_index_t> within
+) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(query->evaluate(*within)),
+        true
+    );
+}
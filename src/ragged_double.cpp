@@ -7,6 +7,7 @@
 
 
 #include "../inst/include/RaggedDouble.h"
+#include "../inst/include/FlatRaggedVariable.h"
 #include "utils.h"
 
 //[[Rcpp::export]]
@@ -19,6 +20,16 @@ Rcpp::XPtr<RaggedDouble> create_double_ragged_variable(
   );
 }
 
+//[[Rcpp::export]]
+Rcpp::XPtr<RaggedDouble> create_flat_double_ragged_variable(
+    const std::vector<std::vector<double>>& values
+) {
+  return Rcpp::XPtr<RaggedDouble>(
+    new FlatRaggedVariable<double>(values),
+    true
+  );
+}
+
 // [[Rcpp::export]]
 std::vector<std::vector<double>> double_ragged_variable_get_values(
     Rcpp::XPtr<RaggedDouble> variable
@@ -43,6 +54,17 @@ std::vector<std::vector<double>> double_ragged_variable_get_values_at_index_vect
   return variable->get_values(index);
 }
 
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> double_ragged_variable_get_index_of_contains(
+    Rcpp::XPtr<RaggedDouble> variable,
+    const double value
+) {
+  return Rcpp::XPtr<individual_index_t>(
+    new individual_index_t(variable->get_index_of_contains(value)),
+    true
+  );
+}
+
 // [[Rcpp::export]]
 std::vector<size_t> double_ragged_variable_get_length(
     Rcpp::XPtr<RaggedDouble> variable
@@ -94,8 +116,44 @@ void double_ragged_variable_queue_update_bitset(
   if (index->max_size() != variable->size()) {
     Rcpp::stop("incompatible size bitset used to queue update for RaggedDouble");
   }
-  auto index_vec = bitset_to_vector_internal(*index, false);
-  variable->queue_update(value, index_vec);
+  variable->queue_update(value, *index);
+}
+
+//[[Rcpp::export]]
+void double_ragged_variable_queue_push_back(
+    Rcpp::XPtr<RaggedDouble> variable,
+    const double value,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_push_back(value, *index);
+}
+
+//[[Rcpp::export]]
+void double_ragged_variable_queue_remove(
+    Rcpp::XPtr<RaggedDouble> variable,
+    const double value,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_remove(value, *index);
+}
+
+//[[Rcpp::export]]
+void double_ragged_variable_queue_remove_range(
+    Rcpp::XPtr<RaggedDouble> variable,
+    const double a,
+    const double b,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_remove_range(a, b, *index);
+}
+
+//[[Rcpp::export]]
+void double_ragged_variable_queue_truncate(
+    Rcpp::XPtr<RaggedDouble> variable,
+    const size_t length,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_truncate(length, *index);
 }
 
 //[[Rcpp::export]]
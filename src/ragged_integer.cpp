@@ -7,6 +7,7 @@
 
 
 #include "../inst/include/RaggedInteger.h"
+#include "../inst/include/FlatRaggedVariable.h"
 #include "utils.h"
 
 //[[Rcpp::export]]
@@ -19,6 +20,16 @@ Rcpp::XPtr<RaggedInteger> create_integer_ragged_variable(
   );
 }
 
+//[[Rcpp::export]]
+Rcpp::XPtr<RaggedInteger> create_flat_integer_ragged_variable(
+    const std::vector<std::vector<int>>& values
+) {
+  return Rcpp::XPtr<RaggedInteger>(
+    new FlatRaggedVariable<int>(values),
+    true
+  );
+}
+
 // [[Rcpp::export]]
 std::vector<std::vector<int>> integer_ragged_variable_get_values(
     Rcpp::XPtr<RaggedInteger> variable
@@ -43,6 +54,24 @@ std::vector<std::vector<int>> integer_ragged_variable_get_values_at_index_vector
   return variable->get_values(index);
 }
 
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> integer_ragged_variable_get_index_of_contains(
+    Rcpp::XPtr<RaggedInteger> variable,
+    const int value
+) {
+  return Rcpp::XPtr<individual_index_t>(
+    new individual_index_t(variable->get_index_of_contains(value)),
+    true
+  );
+}
+
+//[[Rcpp::export]]
+void integer_ragged_variable_enable_inverted_index(
+    Rcpp::XPtr<RaggedInteger> variable
+) {
+  variable->enable_inverted_index();
+}
+
 // [[Rcpp::export]]
 std::vector<size_t> integer_ragged_variable_get_length(
     Rcpp::XPtr<RaggedInteger> variable
@@ -94,8 +123,44 @@ void integer_ragged_variable_queue_update_bitset(
   if (index->max_size() != variable->size()) {
     Rcpp::stop("incompatible size bitset used to queue update for RaggedInteger");
   }
-  auto index_vec = bitset_to_vector_internal(*index, false);
-  variable->queue_update(value, index_vec);
+  variable->queue_update(value, *index);
+}
+
+//[[Rcpp::export]]
+void integer_ragged_variable_queue_push_back(
+    Rcpp::XPtr<RaggedInteger> variable,
+    const int value,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_push_back(value, *index);
+}
+
+//[[Rcpp::export]]
+void integer_ragged_variable_queue_remove(
+    Rcpp::XPtr<RaggedInteger> variable,
+    const int value,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_remove(value, *index);
+}
+
+//[[Rcpp::export]]
+void integer_ragged_variable_queue_remove_range(
+    Rcpp::XPtr<RaggedInteger> variable,
+    const int a,
+    const int b,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_remove_range(a, b, *index);
+}
+
+//[[Rcpp::export]]
+void integer_ragged_variable_queue_truncate(
+    Rcpp::XPtr<RaggedInteger> variable,
+    const size_t length,
+    Rcpp::XPtr<individual_index_t> index
+) {
+  variable->queue_truncate(length, *index);
 }
 
 //[[Rcpp::export]]
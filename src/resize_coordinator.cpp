@@ -0,0 +1,101 @@
+/*
+ * resize_coordinator.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/ResizeCoordinator.h"
+#include "utils.h"
+
+//[[Rcpp::export]]
+Rcpp::XPtr<ResizeCoordinator> create_resize_coordinator(
+    size_t size,
+    size_t threads,
+    bool ordered
+    ) {
+    return Rcpp::XPtr<ResizeCoordinator>(
+        new ResizeCoordinator(size, threads, ordered),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+void resize_coordinator_add_variable(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    Rcpp::XPtr<Variable> variable
+    ) {
+    coordinator->add_variable(*variable);
+}
+
+//[[Rcpp::export]]
+void resize_coordinator_add_event(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    Rcpp::XPtr<TargetedEvent> event
+    ) {
+    coordinator->add_event(*event);
+}
+
+//[[Rcpp::export]]
+void resize_coordinator_queue_shrink_bitset(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    coordinator->queue_shrink(*index);
+}
+
+//[[Rcpp::export]]
+bool resize_coordinator_has_queued_shrink(
+    Rcpp::XPtr<ResizeCoordinator> coordinator
+    ) {
+    return coordinator->has_queued_shrink();
+}
+
+//[[Rcpp::export]]
+void resize_coordinator_tombstone(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    coordinator->tombstone(*index);
+}
+
+//[[Rcpp::export]]
+void resize_coordinator_resize(Rcpp::XPtr<ResizeCoordinator> coordinator) {
+    coordinator->resize();
+}
+
+//[[Rcpp::export]]
+Rcpp::NumericVector resize_coordinator_remap(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    std::vector<size_t> index
+    ) {
+    decrement(index);
+    const auto& plan = coordinator->get_last_plan();
+    auto result = Rcpp::NumericVector(index.size());
+    for (auto i = 0u; i < index.size(); ++i) {
+        if (index[i] >= plan.get_old_size()) {
+            Rcpp::stop("Invalid vector index to remap");
+        }
+        if (plan.is_removed(index[i])) {
+            result[i] = NA_REAL;
+        } else {
+            result[i] = plan.map(index[i]) + 1;
+        }
+    }
+    return result;
+}
+
+//[[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> resize_coordinator_remap_bitset(
+    Rcpp::XPtr<ResizeCoordinator> coordinator,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    const auto& plan = coordinator->get_last_plan();
+    if (index->max_size() > plan.get_old_size()) {
+        Rcpp::stop("Invalid bitset size to remap");
+    }
+    auto result = new individual_index_t(*index);
+    result->extend(plan.get_old_size() - index->max_size());
+    plan.shrink(*result);
+    result->extend(coordinator->size() - plan.get_new_size());
+    return Rcpp::XPtr<individual_index_t>(result, true);
+}
@@ -5,10 +5,187 @@
  *      Author: gc1610
  */
 
-#include "../inst/include/common_types.h"
+#include "../inst/include/Simulation.h"
+#include "../inst/include/Ensemble.h"
+#include "utils.h"
 #include <Rcpp.h>
+#include <string>
 
 //[[Rcpp::export]]
 void execute_process(Rcpp::XPtr<process_t> process, size_t timestep) {
     (*process)(timestep);
 }
+
+//' @title the name of element i of names, or empty if there are none
+inline std::string name_at(const std::vector<std::string>& names, const int i) {
+    return static_cast<size_t>(i) < names.size() ? names[i] : std::string();
+}
+
+//' @title add processes, variables and events passed from R to a simulation
+//' @description C++ processes, variables and listeners are passed as external
+//' pointers, and anything else is called back in R, unless native_only is set.
+//' Each is added under its name in the names lists, if they are given.
+//' Variables called back in R are reported in memory reports if they have a
+//' memory_usage function.
+inline void add_to_simulation(
+    Simulation& simulation,
+    Rcpp::List processes,
+    Rcpp::List variables,
+    Rcpp::List events,
+    const std::vector<bool>& targeted,
+    Rcpp::List listeners,
+    const bool native_only,
+    const std::vector<std::string>& process_names = {},
+    const std::vector<std::string>& variable_names = {},
+    const std::vector<std::string>& event_names = {}
+    ) {
+    for (auto i = 0; i < processes.size(); ++i) {
+        const SEXP process_sexp = processes[i];
+        if (TYPEOF(process_sexp) == EXTPTRSXP) {
+            simulation.add_process(
+                *Rcpp::XPtr<process_t>(process_sexp),
+                true,
+                name_at(process_names, i)
+            );
+        } else if (native_only) {
+            Rcpp::stop("processes must be C++ processes");
+        } else {
+            auto process = Rcpp::Function(process_sexp);
+            simulation.add_process([process](size_t t) {
+                process(static_cast<int>(t));
+            }, false, name_at(process_names, i));
+        }
+    }
+    for (auto i = 0; i < variables.size(); ++i) {
+        const SEXP variable_sexp = variables[i];
+        if (TYPEOF(variable_sexp) == EXTPTRSXP) {
+            simulation.add_variable(
+                *Rcpp::XPtr<Variable>(variable_sexp),
+                name_at(variable_names, i)
+            );
+        } else if (native_only) {
+            Rcpp::stop("variables must be updated and resized in C++");
+        } else {
+            const auto phases = Rcpp::List(variable_sexp);
+            const SEXP update_sexp = phases["update"];
+            const SEXP resize_sexp = phases["resize"];
+            auto update = Rcpp::Function(update_sexp);
+            auto resize = Rcpp::Function(resize_sexp);
+            const SEXP memory_sexp = phases["memory_usage"];
+            auto memory_usage = memory_phase_t();
+            if (Rf_isFunction(memory_sexp)) {
+                auto memory = Rcpp::Function(memory_sexp);
+                memory_usage = [memory]() {
+                    return vector_to_memory_usage(memory());
+                };
+            }
+            simulation.add_variable(
+                [update]() { update(); },
+                [resize]() { resize(); },
+                name_at(variable_names, i),
+                memory_usage
+            );
+        }
+    }
+    for (auto i = 0; i < events.size(); ++i) {
+        const SEXP event_sexp = events[i];
+        const SEXP listeners_sexp = listeners[i];
+        auto event_listeners_list = Rcpp::List(listeners_sexp);
+        auto event_listeners = std::vector<listener_t>();
+        for (auto j = 0; j < event_listeners_list.size(); ++j) {
+            const SEXP listener_sexp = event_listeners_list[j];
+            if (TYPEOF(listener_sexp) == EXTPTRSXP && targeted[i]) {
+                event_listeners.push_back(bind_target(
+                    *Rcpp::XPtr<TargetedEvent>(event_sexp),
+                    *Rcpp::XPtr<targeted_listener_t>(listener_sexp)
+                ));
+            } else if (TYPEOF(listener_sexp) == EXTPTRSXP) {
+                event_listeners.push_back(
+                    *Rcpp::XPtr<listener_t>(listener_sexp)
+                );
+            } else if (native_only) {
+                Rcpp::stop("listeners must be C++ listeners");
+            } else {
+                auto listener = Rcpp::Function(listener_sexp);
+                event_listeners.push_back([listener](size_t) {
+                    listener();
+                });
+            }
+        }
+        simulation.add_event(
+            *Rcpp::XPtr<EventBase>(event_sexp),
+            event_listeners,
+            name_at(event_names, i)
+        );
+    }
+}
+
+//[[Rcpp::export]]
+void execute_simulation(
+    Rcpp::List processes,
+    Rcpp::List variables,
+    Rcpp::List events,
+    std::vector<bool> targeted,
+    Rcpp::List listeners,
+    size_t start,
+    size_t end,
+    size_t threads,
+    double seed,
+    std::vector<std::string> process_names,
+    std::vector<std::string> variable_names,
+    std::vector<std::string> event_names,
+    SEXP profiler,
+    SEXP memory_report
+    ) {
+    Simulation simulation(threads, static_cast<uint64_t>(seed));
+    add_to_simulation(
+        simulation,
+        processes,
+        variables,
+        events,
+        targeted,
+        listeners,
+        false,
+        process_names,
+        variable_names,
+        event_names
+    );
+    simulation.set_interrupt_check([]() { Rcpp::checkUserInterrupt(); });
+    if (TYPEOF(profiler) == EXTPTRSXP) {
+        simulation.set_profiler(*Rcpp::XPtr<Profiler>(profiler));
+    }
+    if (TYPEOF(memory_report) == EXTPTRSXP) {
+        simulation.set_memory_report(*Rcpp::XPtr<MemoryReport>(memory_report));
+    }
+    simulation.run(start, end);
+}
+
+//[[Rcpp::export]]
+void execute_ensemble(
+    Rcpp::List replicates,
+    size_t start,
+    size_t end,
+    size_t threads,
+    double seed
+    ) {
+    Ensemble ensemble(static_cast<uint64_t>(seed));
+    for (auto i = 0; i < replicates.size(); ++i) {
+        const SEXP replicate_sexp = replicates[i];
+        auto replicate = Rcpp::List(replicate_sexp);
+        const SEXP processes = replicate["processes"];
+        const SEXP variables = replicate["variables"];
+        const SEXP events = replicate["events"];
+        const SEXP targeted = replicate["targeted"];
+        const SEXP listeners = replicate["listeners"];
+        add_to_simulation(
+            ensemble.add_replicate(),
+            processes,
+            variables,
+            events,
+            Rcpp::as<std::vector<bool>>(targeted),
+            listeners,
+            true
+        );
+    }
+    ensemble.run(start, end, threads);
+}
@@ -3,6 +3,13 @@
 #include <unordered_set>
 
 #include "../inst/include/IterableBitset.h"
+#include "../inst/include/ResizePlan.h"
+#include "../inst/include/ThreadPool.h"
+#include "../inst/include/Trace.h"
+#include "../inst/include/memory_usage.h"
+#include <map>
+#include <sstream>
+#include <thread>
 
 using individual_index_t = IterableBitset<uint64_t>;
 
@@ -169,6 +176,12 @@ context("Bitset") {
         expect_error(filter_bitset(x, std::cbegin(y), std::cend(y)));
     }
 
+    test_that("Bitset errors are raised as individual_errors") {
+        auto x = individual_index_t(100, {1, 36, 73});
+        expect_error_as(x.insert_safe(101), individual_error);
+        expect_error_as(x |= individual_index_t(50), individual_error);
+    }
+
     test_that("Bitsets can be extended") {
         auto x = individual_index_t(100, {1, 36, 73});
         expect_error(x.insert_safe(101));
@@ -233,4 +246,125 @@ context("Bitset") {
         const auto expected_bitset = individual_index_t(258, {1, 257});
         expect_true(x == expected_bitset);
     }
+
+    test_that("Bitset words can be read") {
+        auto x = individual_index_t(130, {0, 63, 64, 129});
+        expect_true(x.n_words() == 3);
+        expect_true(x.word(0) == ((1ULL << 63) | 1ULL));
+        expect_true(x.word(1) == 1ULL);
+        expect_true(x.word(2) == 2ULL);
+    }
+
+    test_that("Bitset words can be written") {
+        auto x = individual_index_t(130, {0, 63, 64, 129});
+        x.set_word(1, 6ULL);
+        x.set_word(2, ~0ULL);
+        expect_true(x.size() == 6);
+        expect_true(x.word(2) == 3ULL);
+        expect_true(bitset_to_vector_internal(x, false) == std::vector<size_t>({0, 63, 65, 66, 128, 129}));
+    }
+
+    test_that("Bitsets can be subtracted") {
+        auto x = individual_index_t(130, {0, 63, 64, 129});
+        x.subtract(individual_index_t(130, {63, 100, 129}));
+        expect_true(x.size() == 2);
+        expect_true(bitset_to_vector_internal(x, false) == std::vector<size_t>({0, 64}));
+    }
+
+    test_that("Bitsets can be iterated over a range") {
+        auto x = individual_index_t(200, {0, 63, 64, 127, 128, 199});
+        auto visited = std::vector<size_t>();
+        bitset_for_each(x, 64, 128, [&](const size_t i) { visited.push_back(i); });
+        expect_true(visited == std::vector<size_t>({64, 127}));
+    }
+
+    test_that("Resize plans shrink bitsets over word boundaries") {
+        auto x = individual_index_t(200, {0, 62, 64, 65, 130, 199});
+        auto removed = individual_index_t(200, {1, 64, 129});
+        const auto plan = ResizePlan(removed);
+        expect_true(plan.get_new_size() == 197);
+        expect_true(plan.map(65) == 63);
+        expect_true(plan.map(199) == 196);
+        auto expected = x;
+        expected.shrink(bitset_to_vector_internal(removed, false));
+        plan.shrink(x);
+        expect_true(x == expected);
+        expect_true(bitset_to_vector_internal(x, false) == std::vector<size_t>({0, 61, 63, 127, 196}));
+    }
+
+    test_that("Bitsets can be truncated") {
+        auto x = individual_index_t(200, {1, 63, 64, 130, 199});
+        x.truncate(64);
+        expect_true(x.max_size() == 64);
+        expect_true(x.size() == 2);
+        expect_true(x == individual_index_t(64, {1, 63}));
+    }
+
+    test_that("Unordered resize plans move the last survivors into removed slots") {
+        auto x = individual_index_t(6, {1, 4, 5});
+        const auto plan = ResizePlan(individual_index_t(6, {1, 2}), false);
+        expect_true(plan.map(4) == 1);
+        expect_true(plan.map(5) == 2);
+        expect_true(plan.map(3) == 3);
+        plan.shrink(x);
+        expect_true(x == individual_index_t(4, {1, 2}));
+    }
+
+    test_that("Sampling with a process stream does not depend on the thread") {
+        auto rng = rng_t(42);
+        process_rng() = &rng;
+        auto x = individual_index_t(1000);
+        x.inverse();
+        bitset_sample_internal(x, .3);
+        rng = rng_t(42);
+        auto y = individual_index_t(1000);
+        ThreadPool(2).run({[&]() {
+            process_rng() = &rng;
+            y.inverse();
+            bitset_sample_internal(y, .3);
+            process_rng() = nullptr;
+        }});
+        process_rng() = nullptr;
+        expect_true(x == y);
+    }
+
+    test_that("Traces keep the last slices of each thread") {
+        TraceRecorder recorder(2);
+        auto x = individual_index_t(100, {1, 2, 3});
+        const auto y = individual_index_t(100, {2, 3, 4});
+        trace_recorder() = &recorder;
+        x |= y;
+        x &= y;
+        x ^= y;
+        std::thread([&]() { auto z = y; z.inverse(); }).join();
+        trace_recorder() = nullptr;
+        x |= y;
+        expect_true(recorder.size() == 3);
+        auto out = std::ostringstream();
+        recorder.write(out);
+        const auto json = out.str();
+        expect_true(json.find("\"bitset_or\"") == std::string::npos);
+        expect_true(json.find("\"bitset_xor\"") != std::string::npos);
+        expect_true(json.find("\"bitset_inverse\"") != std::string::npos);
+        expect_true(json.find("\"dropped\":1") != std::string::npos);
+    }
+
+    test_that("Memory usage counts the bitsets held in containers") {
+        auto x = individual_index_t(6400, {1, 2, 3});
+        expect_true(x.memory_usage() == 808);
+        auto schedule = std::map<size_t, individual_index_t>();
+        schedule.emplace(1, x);
+        schedule.emplace(2, x);
+        expect_true(
+            heap_bytes(schedule) ==
+            2 * (sizeof(std::pair<const size_t, individual_index_t>) + tree_node_bytes + 808)
+        );
+        auto updates = std::vector<std::pair<std::string, individual_index_t>>();
+        updates.reserve(4);
+        updates.emplace_back("I", x);
+        expect_true(
+            heap_bytes(updates) ==
+            4 * sizeof(std::pair<std::string, individual_index_t>) + 808
+        );
+    }
 }
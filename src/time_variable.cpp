@@ -0,0 +1,94 @@
+/*
+ * time_variable.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+
+#include "../inst/include/TimeVariable.h"
+#include "utils.h"
+
+//[[Rcpp::export]]
+Rcpp::XPtr<TimeVariable> create_time_variable(
+    const std::vector<int>& anchors,
+    const bool since
+    ) {
+    return Rcpp::XPtr<TimeVariable>(
+        new TimeVariable(
+            anchors,
+            since ? time_direction::since : time_direction::until
+        ),
+        true
+    );
+}
+
+//[[Rcpp::export]]
+std::vector<int> time_variable_get_values(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t
+    ) {
+    return variable->get_time_values(t);
+}
+
+//[[Rcpp::export]]
+std::vector<int> time_variable_get_values_at_index(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    return variable->get_time_values(t, *index);
+}
+
+//[[Rcpp::export]]
+std::vector<int> time_variable_get_values_at_index_vector(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    std::vector<size_t> index
+    ) {
+    decrement(index);
+    return variable->get_time_values(t, index);
+}
+
+// [[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> time_variable_get_index_of_set(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    const std::vector<int> values_set
+) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(variable->get_index_of_time_set(t, values_set)),
+        true
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::XPtr<individual_index_t> time_variable_get_index_of_range(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    const int a,
+    const int b
+) {
+    return Rcpp::XPtr<individual_index_t>(
+        new individual_index_t(variable->get_index_of_time_range(t, a, b)),
+        true
+    );
+}
+
+// [[Rcpp::export]]
+size_t time_variable_get_size_of_set(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    const std::vector<int> values_set
+) {
+    return variable->get_size_of_time_set(t, values_set);
+}
+
+// [[Rcpp::export]]
+size_t time_variable_get_size_of_range(
+    Rcpp::XPtr<TimeVariable> variable,
+    const int t,
+    const int a,
+    const int b
+) {
+    return variable->get_size_of_time_range(t, a, b);
+}
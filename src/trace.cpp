@@ -0,0 +1,30 @@
+/*
+ * trace.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "../inst/include/Trace.h"
+#include <Rcpp.h>
+
+//[[Rcpp::export]]
+void trace_start(size_t capacity) {
+    if (trace_recorder().load() != nullptr) {
+        Rcpp::stop("a trace is already being recorded");
+    }
+    trace_recorder().store(new TraceRecorder(capacity));
+}
+
+//[[Rcpp::export]]
+bool trace_active() {
+    return trace_recorder().load() != nullptr;
+}
+
+//[[Rcpp::export]]
+void trace_stop(std::string path) {
+    auto recorder = std::unique_ptr<TraceRecorder>(trace_recorder().exchange(nullptr));
+    if (!recorder) {
+        Rcpp::stop("no trace is being recorded");
+    }
+    recorder->write(path);
+}
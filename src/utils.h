@@ -8,10 +8,78 @@
 #ifndef SRC_UTILS_H_
 #define SRC_UTILS_H_
 
+#include "../inst/include/aggregation.h"
+#include "../inst/include/RRandom.h"
+#include "../inst/include/memory_usage.h"
+#include <Rcpp.h>
+
 template<class A>
 inline void decrement(A& x) {
     for (auto& i : x)
         --i;
 }
 
+inline Rcpp::NumericVector summary_to_vector(const numeric_summary_t& summary) {
+    return Rcpp::NumericVector::create(
+        Rcpp::Named("n") = static_cast<double>(summary.n),
+        Rcpp::Named("sum") = summary.sum,
+        Rcpp::Named("mean") = summary.mean,
+        Rcpp::Named("variance") = summary.variance,
+        Rcpp::Named("min") = summary.min,
+        Rcpp::Named("max") = summary.max
+    );
+}
+
+inline Rcpp::DataFrame summaries_to_data_frame(
+    const std::vector<std::string>& categories,
+    const std::vector<numeric_summary_t>& summaries
+) {
+    const auto n = summaries.size();
+    auto count = Rcpp::NumericVector(n);
+    auto sum = Rcpp::NumericVector(n);
+    auto mean = Rcpp::NumericVector(n);
+    auto variance = Rcpp::NumericVector(n);
+    auto min = Rcpp::NumericVector(n);
+    auto max = Rcpp::NumericVector(n);
+    for (auto i = 0u; i < n; ++i) {
+        count[i] = static_cast<double>(summaries[i].n);
+        sum[i] = summaries[i].sum;
+        mean[i] = summaries[i].mean;
+        variance[i] = summaries[i].variance;
+        min[i] = summaries[i].min;
+        max[i] = summaries[i].max;
+    }
+    return Rcpp::DataFrame::create(
+        Rcpp::Named("category") = categories,
+        Rcpp::Named("n") = count,
+        Rcpp::Named("sum") = sum,
+        Rcpp::Named("mean") = mean,
+        Rcpp::Named("variance") = variance,
+        Rcpp::Named("min") = min,
+        Rcpp::Named("max") = max,
+        Rcpp::Named("stringsAsFactors") = false
+    );
+}
+
+//' @title bytes are returned as doubles, since they can overflow an integer
+inline Rcpp::NumericVector memory_usage_to_vector(const memory_usage_t& usage) {
+    return Rcpp::NumericVector::create(
+        Rcpp::Named("storage") = static_cast<double>(usage.storage),
+        Rcpp::Named("updates") = static_cast<double>(usage.updates),
+        Rcpp::Named("resizes") = static_cast<double>(usage.resizes)
+    );
+}
+
+//' @title read bytes in the order memory_usage_to_vector returns them
+inline memory_usage_t vector_to_memory_usage(const Rcpp::NumericVector& usage) {
+    if (usage.size() != 3) {
+        Rcpp::stop("memory usage must have storage, updates and resizes");
+    }
+    auto result = memory_usage_t();
+    result.storage = static_cast<size_t>(usage[0]);
+    result.updates = static_cast<size_t>(usage[1]);
+    result.resizes = static_cast<size_t>(usage[2]);
+    return result;
+}
+
 #endif /* SRC_UTILS_H_ */
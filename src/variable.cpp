@@ -7,6 +7,7 @@
 
 
 #include "../inst/include/Variable.h"
+#include "utils.h"
 #include <Rcpp.h>
 
 //[[Rcpp::export]]
@@ -14,12 +15,38 @@ size_t variable_get_size(Rcpp::XPtr<Variable> variable) {
     return variable->size();
 }
 
+//[[Rcpp::export]]
+Rcpp::NumericVector variable_memory_usage(Rcpp::XPtr<Variable> variable) {
+    return memory_usage_to_vector(variable->memory_usage());
+}
+
 //[[Rcpp::export]]
 void variable_update(Rcpp::XPtr<Variable> variable) {
+    TraceScope trace("variable_update", "update");
     variable->update();
 }
 
 //[[Rcpp::export]]
 void variable_resize(Rcpp::XPtr<Variable> variable) {
+    TraceScope trace("variable_resize", "resize");
     variable->resize();
 }
+
+//[[Rcpp::export]]
+void variable_tombstone(
+    Rcpp::XPtr<Variable> variable,
+    Rcpp::XPtr<individual_index_t> index
+    ) {
+    variable->tombstone(*index);
+}
+
+//[[Rcpp::export]]
+void variables_update_resize(Rcpp::List variables, size_t threads) {
+    auto pointers = std::vector<Variable*>();
+    for (SEXP variable : variables) {
+        pointers.push_back(Rcpp::XPtr<Variable>(variable).get());
+    }
+    ThreadPool pool(threads);
+    update_variables(pointers, pool);
+    resize_variables(pointers, pool);
+}
@@ -0,0 +1,237 @@
+/*
+ * bench_bitset.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+
+static void BM_BitsetInsert(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto values = bitset_to_vector_internal(random_index(size, state.range(1)), false);
+    for (auto _ : state) {
+        auto index = individual_index_t(size);
+        index.insert(values.cbegin(), values.cend());
+        benchmark::DoNotOptimize(index);
+    }
+    set_individuals_processed(state, values.size());
+}
+BENCHMARK(BM_BitsetInsert)->Apply(population_density_args);
+
+static void BM_BitsetErase(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto index = random_index(size, state.range(1));
+    const auto values = bitset_to_vector_internal(index, false);
+    for (auto _ : state) {
+        auto erased = index;
+        for (auto v : values) {
+            erased.erase(v);
+        }
+        benchmark::DoNotOptimize(erased);
+    }
+    set_individuals_processed(state, values.size());
+}
+BENCHMARK(BM_BitsetErase)->Apply(population_density_args);
+
+static void BM_BitsetEraseRange(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto index = random_index(size, state.range(1));
+    for (auto _ : state) {
+        auto erased = index;
+        erased.erase(size / 4, 3 * size / 4);
+        benchmark::DoNotOptimize(erased);
+    }
+}
+BENCHMARK(BM_BitsetEraseRange)->Apply(population_density_args);
+
+static void BM_BitsetFind(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto index = random_index(size, state.range(1));
+    auto found = size_t(0);
+    for (auto _ : state) {
+        for (auto i = 0u; i < index.max_size(); ++i) {
+            found += index.find(i) != index.cend();
+        }
+    }
+    benchmark::DoNotOptimize(found);
+    set_individuals_processed(state, size);
+}
+BENCHMARK(BM_BitsetFind)->Apply(population_density_args);
+
+static void BM_BitsetSize(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.size());
+    }
+}
+BENCHMARK(BM_BitsetSize)->Apply(population_density_args);
+
+static void BM_BitsetAnd(benchmark::State& state) {
+    const auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a & b);
+    }
+}
+BENCHMARK(BM_BitsetAnd)->Apply(population_density_args);
+
+static void BM_BitsetOr(benchmark::State& state) {
+    const auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a | b);
+    }
+}
+BENCHMARK(BM_BitsetOr)->Apply(population_density_args);
+
+static void BM_BitsetXor(benchmark::State& state) {
+    const auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a ^ b);
+    }
+}
+BENCHMARK(BM_BitsetXor)->Apply(population_density_args);
+
+static void BM_BitsetNot(benchmark::State& state) {
+    const auto a = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(!a);
+    }
+}
+BENCHMARK(BM_BitsetNot)->Apply(population_density_args);
+
+static void BM_BitsetAndInPlace(benchmark::State& state) {
+    auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        a &= b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_BitsetAndInPlace)->Apply(population_density_args);
+
+static void BM_BitsetOrInPlace(benchmark::State& state) {
+    auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        a |= b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_BitsetOrInPlace)->Apply(population_density_args);
+
+static void BM_BitsetXorInPlace(benchmark::State& state) {
+    auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        a ^= b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_BitsetXorInPlace)->Apply(population_density_args);
+
+static void BM_BitsetSubtract(benchmark::State& state) {
+    auto a = random_index(state.range(0), state.range(1));
+    const auto b = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        a.subtract(b);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_BitsetSubtract)->Apply(population_density_args);
+
+static void BM_BitsetInverse(benchmark::State& state) {
+    auto a = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        a.inverse();
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_BitsetInverse)->Apply(population_density_args);
+
+static void BM_BitsetClear(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        auto cleared = index;
+        cleared.clear();
+        benchmark::DoNotOptimize(cleared);
+    }
+}
+BENCHMARK(BM_BitsetClear)->Apply(population_density_args);
+
+static void BM_BitsetCopy(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        auto copy = index;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_BitsetCopy)->Apply(population_density_args);
+
+static void BM_BitsetEquals(benchmark::State& state) {
+    const auto a = random_index(state.range(0), state.range(1));
+    const auto b = a;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a == b);
+    }
+}
+BENCHMARK(BM_BitsetEquals)->Apply(population_density_args);
+
+static void BM_BitsetIterate(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    auto total = size_t(0);
+    for (auto _ : state) {
+        for (auto i : index) {
+            total += i;
+        }
+    }
+    benchmark::DoNotOptimize(total);
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_BitsetIterate)->Apply(population_density_args);
+
+static void BM_BitsetForEach(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    auto total = size_t(0);
+    for (auto _ : state) {
+        bitset_for_each(index, [&](const size_t i) { total += i; });
+    }
+    benchmark::DoNotOptimize(total);
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_BitsetForEach)->Apply(population_density_args);
+
+static void BM_BitsetToVector(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bitset_to_vector_internal(index));
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_BitsetToVector)->Apply(population_density_args);
+
+static void BM_BitsetFromVector(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto values = bitset_to_vector_internal(random_index(size, state.range(1)), false);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(individual_index_t(size, values));
+    }
+    set_individuals_processed(state, values.size());
+}
+BENCHMARK(BM_BitsetFromVector)->Apply(population_density_args);
+
+static void BM_BitsetFilter(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    auto positions = std::vector<size_t>();
+    for (auto i = 0u; i < index.size(); i += 2) {
+        positions.push_back(i);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            filter_bitset(index, positions.cbegin(), positions.cend())
+        );
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_BitsetFilter)->Apply(population_density_args);
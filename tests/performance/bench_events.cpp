@@ -0,0 +1,121 @@
+/*
+ * bench_events.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+#include "Event.h"
+
+// events are scheduled over the next 30 timesteps, and ticked along so that
+// the schedule stays the same length
+
+static const auto horizon = 30;
+
+static void BM_EventSchedule(benchmark::State& state) {
+    Event event;
+    auto delays = random_doubles(state.range(0));
+    for (auto& delay : delays) {
+        delay *= horizon;
+    }
+    for (auto _ : state) {
+        event.schedule(delays);
+        event.tick();
+    }
+    set_individuals_processed(state, delays.size());
+}
+BENCHMARK(BM_EventSchedule)->Apply(population_args);
+
+static void BM_TargetedEventScheduleFixed(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        event.schedule(index, size_t(horizon));
+        event.tick();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_TargetedEventScheduleFixed)->Apply(population_density_args);
+
+static void BM_TargetedEventScheduleDelays(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    const auto index = random_index(state.range(0), state.range(1));
+    auto delays = random_doubles(index.size());
+    for (auto& delay : delays) {
+        delay *= horizon;
+    }
+    for (auto _ : state) {
+        event.schedule(index, delays);
+        event.tick();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_TargetedEventScheduleDelays)->Apply(population_density_args);
+
+static void BM_TargetedEventScheduleVector(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    const auto index = bitset_to_vector_internal(
+        random_index(state.range(0), state.range(1)),
+        false
+    );
+    auto delays = random_doubles(index.size());
+    for (auto& delay : delays) {
+        delay *= horizon;
+    }
+    for (auto _ : state) {
+        event.schedule(index, delays);
+        event.tick();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_TargetedEventScheduleVector)->Apply(population_density_args);
+
+// fill the schedule of a targeted event with the individuals in index, spread
+// over the horizon
+static void fill_schedule(TargetedEvent& event, const individual_index_t& index) {
+    auto delays = random_doubles(index.size());
+    for (auto& delay : delays) {
+        delay = 1 + delay * (horizon - 1);
+    }
+    event.schedule(index, delays);
+}
+
+static void BM_TargetedEventTrigger(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    const auto index = random_index(state.range(0), state.range(1));
+    fill_schedule(event, index);
+    auto triggered = size_t(0);
+    for (auto _ : state) {
+        if (event.should_trigger()) {
+            event.process([&](size_t, const individual_index_t& target) {
+                triggered += target.size();
+                event.schedule(target, size_t(horizon - 1));
+            });
+        }
+        event.tick();
+    }
+    benchmark::DoNotOptimize(triggered);
+}
+BENCHMARK(BM_TargetedEventTrigger)->Apply(population_density_args);
+
+static void BM_TargetedEventClearSchedule(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    const auto index = random_index(state.range(0), state.range(1));
+    const auto cleared = random_index(state.range(0), 10);
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill_schedule(event, index);
+        state.ResumeTiming();
+        event.clear_schedule(cleared);
+    }
+}
+BENCHMARK(BM_TargetedEventClearSchedule)->Apply(population_density_args);
+
+static void BM_TargetedEventGetScheduled(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    fill_schedule(event, random_index(state.range(0), state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(event.get_scheduled());
+    }
+}
+BENCHMARK(BM_TargetedEventGetScheduled)->Apply(population_density_args);
@@ -0,0 +1,132 @@
+/*
+ * bench_prefab.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+#include "prefab.h"
+
+// the second argument is the percentage of the population in the state that
+// the process moves individuals out of. After each run of the process, the
+// queued changes are applied and then undone with timing paused, so that every
+// iteration starts from the same state.
+
+static const std::vector<std::string> states = {"S", "E", "I", "R"};
+
+//' @title SEIR states with density percent of the population in source
+static std::vector<std::string> seir_states(
+    const size_t size,
+    const int64_t density,
+    const std::string& source
+) {
+    auto values = random_categories(size, states);
+    auto in_source = std::bernoulli_distribution(density / 100.);
+    for (auto& value : values) {
+        if (in_source(bench_rng())) {
+            value = source;
+        } else if (value == source) {
+            value = "R";
+        }
+    }
+    return values;
+}
+
+//' @title run a process on each iteration and restore the source state after
+static void run_process(
+    benchmark::State& state,
+    const process_t& process,
+    CategoricalVariable& variable,
+    const std::string& source
+) {
+    const auto initial = variable.get_index_of(source);
+    auto t = size_t(1);
+    for (auto _ : state) {
+        process(t++);
+        state.PauseTiming();
+        variable.update();
+        variable.queue_update(source, initial);
+        variable.update();
+        state.ResumeTiming();
+    }
+    set_individuals_processed(state, initial.size());
+}
+
+static void BM_FixedProbabilityMultinomialProcess(benchmark::State& state) {
+    CategoricalVariable variable(states, seir_states(state.range(0), state.range(1), "I"));
+    const auto process = fixed_probability_multinomial_process(
+        variable,
+        "I",
+        {"R", "S"},
+        .1,
+        {.9, .1}
+    );
+    run_process(state, process, variable, "I");
+}
+BENCHMARK(BM_FixedProbabilityMultinomialProcess)->Apply(population_density_args);
+
+static void BM_MultiProbabilityMultinomialProcess(benchmark::State& state) {
+    CategoricalVariable variable(states, seir_states(state.range(0), state.range(1), "I"));
+    auto rates = random_doubles(state.range(0));
+    for (auto& rate : rates) {
+        rate *= .2;
+    }
+    const DoubleVariable rate(rates);
+    const auto process = multi_probability_multinomial_process(
+        variable,
+        "I",
+        {"R", "S"},
+        rate,
+        {.9, .1}
+    );
+    run_process(state, process, variable, "I");
+}
+BENCHMARK(BM_MultiProbabilityMultinomialProcess)->Apply(population_density_args);
+
+static void BM_MultiProbabilityBernoulliProcess(benchmark::State& state) {
+    CategoricalVariable variable(states, seir_states(state.range(0), state.range(1), "E"));
+    auto rates = random_doubles(state.range(0));
+    for (auto& rate : rates) {
+        rate *= .2;
+    }
+    const DoubleVariable rate(rates);
+    const auto process = multi_probability_bernoulli_process(variable, "E", "I", rate);
+    run_process(state, process, variable, "E");
+}
+BENCHMARK(BM_MultiProbabilityBernoulliProcess)->Apply(population_density_args);
+
+static void BM_InfectionAgeProcess(benchmark::State& state) {
+    const auto age_bins = 20;
+    CategoricalVariable variable(states, seir_states(state.range(0), state.range(1), "S"));
+    const IntegerVariable age(random_integers(state.range(0), 1, age_bins));
+    const auto mixing = random_doubles(age_bins * age_bins);
+    const auto process = infection_age_process(
+        variable,
+        "S",
+        "E",
+        "I",
+        age,
+        age_bins,
+        .1,
+        1,
+        mixing.data(),
+        age_bins
+    );
+    run_process(state, process, variable, "S");
+}
+BENCHMARK(BM_InfectionAgeProcess)->Apply(population_density_args);
+
+static void BM_CategoricalCountRendererProcess(benchmark::State& state) {
+    const CategoricalVariable variable(states, random_categories(state.range(0), states));
+    auto vectors = std::vector<RenderVector>(states.size(), RenderVector(std::vector<double>(100)));
+    auto targets = std::vector<RenderVector*>();
+    for (auto& vector : vectors) {
+        targets.push_back(&vector);
+    }
+    const auto process = categorical_count_renderer_process(targets, variable, states);
+    auto t = size_t(0);
+    for (auto _ : state) {
+        process(t++ % 100 + 1);
+    }
+}
+BENCHMARK(BM_CategoricalCountRendererProcess)->Apply(population_args);
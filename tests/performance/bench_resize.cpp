@@ -0,0 +1,146 @@
+/*
+ * bench_resize.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+#include "CategoricalVariable.h"
+#include "DoubleVariable.h"
+#include "IntegerVariable.h"
+#include "RaggedInteger.h"
+#include "Event.h"
+#include "Population.h"
+#include "ResizeCoordinator.h"
+#include "ResizePlan.h"
+
+// the second argument is the percentage of the population removed, and
+// replaced by as many new individuals, on each resize
+
+static const std::vector<std::string> states = {"S", "E", "I", "R"};
+
+static void BM_ResizePlan(benchmark::State& state) {
+    const auto removed = random_index(state.range(0), state.range(1));
+    const auto ordered = state.range(2) != 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ResizePlan(removed, ordered));
+    }
+}
+BENCHMARK(BM_ResizePlan)
+    ->ArgNames({"size", "density", "ordered"})
+    ->ArgsProduct({population_sizes, densities, {0, 1}});
+
+static void BM_DoubleResize(benchmark::State& state) {
+    DoubleVariable variable(random_doubles(state.range(0)));
+    const auto removed = random_index(state.range(0), state.range(1));
+    const auto values = random_doubles(removed.size());
+    for (auto _ : state) {
+        variable.queue_shrink(removed);
+        variable.queue_extend(values);
+        variable.resize();
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_DoubleResize)->Apply(population_density_args);
+
+static void BM_IntegerResize(benchmark::State& state) {
+    IntegerVariable variable(random_integers(state.range(0), 1, 100));
+    const auto removed = random_index(state.range(0), state.range(1));
+    const auto values = random_integers(removed.size(), 1, 100);
+    for (auto _ : state) {
+        variable.queue_shrink(removed);
+        variable.queue_extend(values);
+        variable.resize();
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_IntegerResize)->Apply(population_density_args);
+
+static void BM_CategoricalResize(benchmark::State& state) {
+    CategoricalVariable variable(states, random_categories(state.range(0), states));
+    const auto removed = random_index(state.range(0), state.range(1));
+    const auto values = random_categories(removed.size(), states);
+    for (auto _ : state) {
+        variable.queue_shrink(removed);
+        variable.queue_extend(values);
+        variable.resize();
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_CategoricalResize)->Apply(population_density_args);
+
+static void BM_RaggedResize(benchmark::State& state) {
+    auto initial = std::vector<std::vector<int>>();
+    for (auto i = 0; i < state.range(0); ++i) {
+        initial.push_back(random_integers(3, 1, 100));
+    }
+    RaggedInteger variable(initial);
+    const auto removed = random_index(state.range(0), state.range(1));
+    const auto values = std::vector<std::vector<int>>(removed.size(), {1, 2, 3});
+    for (auto _ : state) {
+        variable.queue_shrink(removed);
+        variable.queue_extend(values);
+        variable.resize();
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_RaggedResize)->Apply(population_density_args);
+
+static void BM_TargetedEventResize(benchmark::State& state) {
+    TargetedEvent event(state.range(0));
+    event.schedule(random_index(state.range(0), 50), size_t(5));
+    const auto removed = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        event.queue_shrink(removed);
+        event.queue_extend(removed.size());
+        event.resize();
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_TargetedEventResize)->Apply(population_density_args);
+
+// the variables and event of an SEIR model, resized together by a coordinator
+static void BM_CoordinatorResize(benchmark::State& state) {
+    const auto size = state.range(0);
+    CategoricalVariable health(states, random_categories(size, states));
+    DoubleVariable immunity(random_doubles(size));
+    IntegerVariable age(random_integers(size, 1, 100));
+    TargetedEvent recovery(size);
+    recovery.schedule(random_index(size, 50), size_t(5));
+    ResizeCoordinator coordinator(size, 1, state.range(2) != 0);
+    coordinator.add_variable(health);
+    coordinator.add_variable(immunity);
+    coordinator.add_variable(age);
+    coordinator.add_event(recovery);
+
+    const auto removed = random_index(size, state.range(1));
+    const auto n = removed.size();
+    const auto health_values = random_categories(n, states);
+    const auto immunity_values = random_doubles(n);
+    const auto age_values = random_integers(n, 1, 100);
+    for (auto _ : state) {
+        coordinator.queue_shrink(removed);
+        health.queue_extend(health_values);
+        immunity.queue_extend(immunity_values);
+        age.queue_extend(age_values);
+        recovery.queue_extend(n);
+        coordinator.resize();
+    }
+    set_individuals_processed(state, size);
+}
+BENCHMARK(BM_CoordinatorResize)
+    ->ArgNames({"size", "density", "ordered"})
+    ->ArgsProduct({population_sizes, densities, {0, 1}});
+
+static void BM_PopulationResize(benchmark::State& state) {
+    Population population(state.range(0), 1.);
+    const auto removed = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        population.queue_shrink(removed);
+        population.resize();
+        population.queue_extend(removed.size());
+        population.resize();
+    }
+    set_individuals_processed(state, removed.size());
+}
+BENCHMARK(BM_PopulationResize)->Apply(population_density_args);
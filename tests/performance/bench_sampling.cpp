@@ -0,0 +1,68 @@
+/*
+ * bench_sampling.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+#include "Random.h"
+
+// the second argument is the density of the bitset sampled from, and each
+// individual in it is kept with probability 1 / 10
+
+static void BM_SampleRate(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        auto sampled = index;
+        bitset_sample_internal(sampled, .1);
+        benchmark::DoNotOptimize(sampled);
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_SampleRate)->Apply(population_density_args);
+
+static void BM_SampleRateHigh(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        auto sampled = index;
+        bitset_sample_internal(sampled, .9);
+        benchmark::DoNotOptimize(sampled);
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_SampleRateHigh)->Apply(population_density_args);
+
+static void BM_SampleMulti(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    auto rates = random_doubles(index.size());
+    for (auto& rate : rates) {
+        rate *= .2;
+    }
+    for (auto _ : state) {
+        auto sampled = index;
+        bitset_sample_multi_internal(sampled, rates.cbegin(), rates.cend());
+        benchmark::DoNotOptimize(sampled);
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_SampleMulti)->Apply(population_density_args);
+
+static void BM_Choose(benchmark::State& state) {
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        auto chosen = index;
+        bitset_choose_internal(chosen, index.size() / 10);
+        benchmark::DoNotOptimize(chosen);
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_Choose)->Apply(population_density_args);
+
+static void BM_RandomUniforms(benchmark::State& state) {
+    const auto n = state.range(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(random_uniforms(n));
+    }
+    set_individuals_processed(state, n);
+}
+BENCHMARK(BM_RandomUniforms)->Apply(population_args);
@@ -0,0 +1,89 @@
+/*
+ * bench_utils.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef TESTS_PERFORMANCE_BENCH_UTILS_H_
+#define TESTS_PERFORMANCE_BENCH_UTILS_H_
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "common_types.h"
+
+// Benchmarks over a population take its size as their first argument and,
+// where it matters, the density of the individuals they act on as a
+// percentage of the population as their second. The smallest size is 1024, so
+// that --benchmark_filter=size:1024/ runs each benchmark once, quickly.
+static const std::vector<int64_t> population_sizes = {1 << 10, 1 << 14, 1 << 17, 1 << 20};
+static const std::vector<int64_t> densities = {1, 10, 50, 90};
+
+inline void population_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"size"})->ArgsProduct({population_sizes});
+}
+
+inline void population_density_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"size", "density"})->ArgsProduct({population_sizes, densities});
+}
+
+//' @title the random number generator for benchmark inputs
+//' @description seeded the same way on every run, so that each run benchmarks
+//' the same inputs
+inline std::mt19937_64& bench_rng() {
+    static std::mt19937_64 rng(42);
+    return rng;
+}
+
+//' @title a bitset with each individual set with probability density / 100
+inline individual_index_t random_index(const size_t size, const int64_t density) {
+    auto index = individual_index_t(size);
+    auto bernoulli = std::bernoulli_distribution(density / 100.);
+    for (auto i = 0u; i < size; ++i) {
+        if (bernoulli(bench_rng())) {
+            index.insert(i);
+        }
+    }
+    return index;
+}
+
+//' @title n uniform random doubles in [0, 1)
+inline std::vector<double> random_doubles(const size_t n) {
+    auto result = std::vector<double>(n);
+    auto uniform = std::uniform_real_distribution<double>();
+    for (auto& x : result) {
+        x = uniform(bench_rng());
+    }
+    return result;
+}
+
+//' @title n random integers in [a, b]
+inline std::vector<int> random_integers(const size_t n, const int a, const int b) {
+    auto result = std::vector<int>(n);
+    auto uniform = std::uniform_int_distribution<int>(a, b);
+    for (auto& x : result) {
+        x = uniform(bench_rng());
+    }
+    return result;
+}
+
+//' @title n states, each chosen from categories with equal probability
+inline std::vector<std::string> random_categories(
+    const size_t n,
+    const std::vector<std::string>& categories
+) {
+    auto result = std::vector<std::string>(n);
+    auto uniform = std::uniform_int_distribution<size_t>(0, categories.size() - 1);
+    for (auto& x : result) {
+        x = categories[uniform(bench_rng())];
+    }
+    return result;
+}
+
+//' @title label a benchmark with the number of individuals it processes
+inline void set_individuals_processed(benchmark::State& state, const size_t n) {
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+#endif /* TESTS_PERFORMANCE_BENCH_UTILS_H_ */
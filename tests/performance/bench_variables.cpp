@@ -0,0 +1,251 @@
+/*
+ * bench_variables.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "bench_utils.h"
+#include "CategoricalVariable.h"
+#include "DoubleVariable.h"
+#include "IntegerVariable.h"
+#include "CompactVariable.h"
+#include "RaggedInteger.h"
+#include "crosstab.h"
+#include "ThreadPool.h"
+
+static const std::vector<std::string> states = {"S", "E", "I", "R"};
+
+// queries
+
+static void BM_CategoricalGetIndexOf(benchmark::State& state) {
+    const CategoricalVariable variable(states, random_categories(state.range(0), states));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of(std::vector<std::string>{"I", "R"}));
+    }
+}
+BENCHMARK(BM_CategoricalGetIndexOf)->Apply(population_args);
+
+static void BM_CategoricalGetSizeOf(benchmark::State& state) {
+    const CategoricalVariable variable(states, random_categories(state.range(0), states));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_size_of(std::vector<std::string>{"I", "R"}));
+    }
+}
+BENCHMARK(BM_CategoricalGetSizeOf)->Apply(population_args);
+
+static void BM_CategoricalGetIndexOfCached(benchmark::State& state) {
+    CategoricalVariable variable(states, random_categories(state.range(0), states));
+    variable.enable_cache();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_cached({"I", "R"}));
+    }
+}
+BENCHMARK(BM_CategoricalGetIndexOfCached)->Apply(population_args);
+
+static void BM_DoubleGetValues(benchmark::State& state) {
+    const DoubleVariable variable(random_doubles(state.range(0)));
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_values(index));
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_DoubleGetValues)->Apply(population_density_args);
+
+static void BM_DoubleGetIndexOfRange(benchmark::State& state) {
+    const DoubleVariable variable(random_doubles(state.range(0)));
+    const auto upper = state.range(1) / 100.;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_range(0, upper));
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_DoubleGetIndexOfRange)->Apply(population_density_args);
+
+static void BM_DoubleGetSummary(benchmark::State& state) {
+    const DoubleVariable variable(random_doubles(state.range(0)));
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_summary(index));
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_DoubleGetSummary)->Apply(population_density_args);
+
+static void BM_CompactDoubleGetIndexOfRange(benchmark::State& state) {
+    const CompactDoubleVariable<float> variable(random_doubles(state.range(0)));
+    const auto upper = state.range(1) / 100.;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_range(0, upper));
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_CompactDoubleGetIndexOfRange)->Apply(population_density_args);
+
+static void BM_IntegerGetIndexOfSet(benchmark::State& state) {
+    const IntegerVariable variable(random_integers(state.range(0), 1, 100));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_set(std::vector<int>{1, 5, 10, 50}));
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_IntegerGetIndexOfSet)->Apply(population_args);
+
+static void BM_IntegerGetSizeOfRange(benchmark::State& state) {
+    const IntegerVariable variable(random_integers(state.range(0), 1, 100));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_size_of_range(10, 60));
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_IntegerGetSizeOfRange)->Apply(population_args);
+
+static void BM_CompactIntegerGetIndexOfSet(benchmark::State& state) {
+    const CompactIntegerVariable<uint8_t> variable(random_integers(state.range(0), 1, 100));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_set(std::vector<int>{1, 5, 10, 50}));
+    }
+    set_individuals_processed(state, state.range(0));
+}
+BENCHMARK(BM_CompactIntegerGetIndexOfSet)->Apply(population_args);
+
+static void BM_RaggedGetIndexOfContains(benchmark::State& state) {
+    auto values = std::vector<std::vector<int>>();
+    for (auto i = 0; i < state.range(0); ++i) {
+        values.push_back(random_integers(3, 1, 100));
+    }
+    RaggedInteger variable(values);
+    if (state.range(1)) {
+        variable.enable_inverted_index();
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(variable.get_index_of_contains(42));
+    }
+}
+BENCHMARK(BM_RaggedGetIndexOfContains)
+    ->ArgNames({"size", "inverted"})
+    ->ArgsProduct({population_sizes, {0, 1}});
+
+static void BM_Crosstab(benchmark::State& state) {
+    const auto size = state.range(0);
+    const CategoricalVariable variable(states, random_categories(size, states));
+    const IntegerVariable age(random_integers(size, 1, 20));
+    auto levels = std::vector<int>(20);
+    std::iota(levels.begin(), levels.end(), 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crosstab_categorical_integer(variable, age, levels, nullptr));
+    }
+    set_individuals_processed(state, size);
+}
+BENCHMARK(BM_Crosstab)->Apply(population_args);
+
+// updates, queued and then applied
+
+static void BM_CategoricalUpdate(benchmark::State& state) {
+    CategoricalVariable variable(states, random_categories(state.range(0), states));
+    const auto index = random_index(state.range(0), state.range(1));
+    auto i = size_t(0);
+    for (auto _ : state) {
+        variable.queue_update(states[i++ % states.size()], index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_CategoricalUpdate)->Apply(population_density_args);
+
+static void BM_DoubleUpdateFill(benchmark::State& state) {
+    DoubleVariable variable(random_doubles(state.range(0)));
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        variable.queue_update({.5}, index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_DoubleUpdateFill)->Apply(population_density_args);
+
+static void BM_DoubleUpdateValues(benchmark::State& state) {
+    DoubleVariable variable(random_doubles(state.range(0)));
+    const auto index = random_index(state.range(0), state.range(1));
+    const auto values = random_doubles(index.size());
+    for (auto _ : state) {
+        variable.queue_update(values, index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_DoubleUpdateValues)->Apply(population_density_args);
+
+static void BM_DoubleUpdateVector(benchmark::State& state) {
+    DoubleVariable variable(random_doubles(state.range(0)));
+    const auto index = bitset_to_vector_internal(
+        random_index(state.range(0), state.range(1)),
+        false
+    );
+    const auto values = random_doubles(index.size());
+    for (auto _ : state) {
+        variable.queue_update(values, index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_DoubleUpdateVector)->Apply(population_density_args);
+
+static void BM_DoubleUpdateReplace(benchmark::State& state) {
+    DoubleVariable variable(random_doubles(state.range(0)));
+    const auto values = random_doubles(state.range(0));
+    for (auto _ : state) {
+        variable.queue_update(values, std::vector<size_t>());
+        variable.update();
+    }
+    set_individuals_processed(state, values.size());
+}
+BENCHMARK(BM_DoubleUpdateReplace)->Apply(population_args);
+
+static void BM_CompactIntegerUpdateValues(benchmark::State& state) {
+    CompactIntegerVariable<uint8_t> variable(random_integers(state.range(0), 1, 100));
+    const auto index = random_index(state.range(0), state.range(1));
+    const auto values = random_integers(index.size(), 1, 100);
+    for (auto _ : state) {
+        variable.queue_update(values, index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_CompactIntegerUpdateValues)->Apply(population_density_args);
+
+static void BM_RaggedPushBack(benchmark::State& state) {
+    RaggedInteger variable(std::vector<std::vector<int>>(state.range(0)));
+    const auto index = random_index(state.range(0), state.range(1));
+    for (auto _ : state) {
+        variable.queue_push_back(1, index);
+        variable.queue_truncate(4, index);
+        variable.update();
+    }
+    set_individuals_processed(state, index.size());
+}
+BENCHMARK(BM_RaggedPushBack)->Apply(population_density_args);
+
+// the variables of an SEIR model with a double and an integer variable,
+// updated together on a pool of threads
+static void BM_UpdateVariablesPool(benchmark::State& state) {
+    const auto size = state.range(0);
+    CategoricalVariable health(states, random_categories(size, states));
+    DoubleVariable immunity(random_doubles(size));
+    IntegerVariable age(random_integers(size, 1, 100));
+    const auto variables = std::vector<Variable*>{&health, &immunity, &age};
+    const auto index = random_index(size, 10);
+    const auto values = random_doubles(index.size());
+    ThreadPool pool(state.range(1));
+    for (auto _ : state) {
+        health.queue_update("R", index);
+        immunity.queue_update(values, index);
+        age.queue_update({1}, index);
+        update_variables(variables, pool);
+    }
+    set_individuals_processed(state, size);
+}
+BENCHMARK(BM_UpdateVariablesPool)
+    ->ArgNames({"size", "threads"})
+    ->ArgsProduct({population_sizes, {1, 2, 4}})
+    ->UseRealTime();
@@ -0,0 +1,342 @@
+/*
+ * reference_models.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ *  Runs the reference models end to end and compares their wall time, peak
+ *  memory and per-phase timings against a stored baseline. Each model is run
+ *  in its own child process, so that its peak memory can be measured on its
+ *  own.
+ *
+ *  Usage:
+ *    individual_reference_models [--models sir,seir,age,demography]
+ *      [--sizes 100000,1000000,10000000] [--timesteps 100] [--seed 42]
+ *      [--out results.csv] [--baseline reference_baseline.csv]
+ *      [--threshold 0.1] [--min-seconds 0.05] [--trace directory]
+ *
+ *  The results are written as csv with one row per model, size and metric.
+ *  Besides timings, the metrics include the peak resident memory of each run
+ *  and the peak estimated memory of each variable and event, sampled every 10
+ *  timesteps (see MemoryReport).
+ *  The baseline holds timings from one machine, so it is only regenerated
+ *  when the metrics change or the comparison machine does, in a commit of
+ *  its own:
+ *    individual_reference_models --out tests/performance/reference_baseline.csv
+ *  Metrics missing from the baseline are not compared. With a baseline, any
+ *  metric which is more than threshold (as a fraction) worse than its
+ *  baseline is reported, and the runner exits with status 1. Timings shorter
+ *  than min-seconds in the baseline are too noisy to compare, and are
+ *  skipped.
+ *  With --trace, a Chrome trace of each run is written to the directory as
+ *  <model>_<size>.json. Tracing slows the models down, so the timings of
+ *  traced runs should not be compared against the baseline.
+ */
+
+#include "reference_models.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct Options {
+    std::vector<std::string> models = reference_model_names();
+    std::vector<size_t> sizes = {100000, 1000000, 10000000};
+    size_t timesteps = 100;
+    uint64_t seed = 42;
+    std::string out;
+    std::string baseline;
+    double threshold = .1;
+    double min_seconds = .05;
+    std::string trace;
+};
+
+struct Result {
+    std::string model;
+    size_t size;
+    std::string metric;
+    double value;
+};
+
+using result_key_t = std::tuple<std::string, size_t, std::string>;
+
+static std::vector<std::string> split(const std::string& s, const char delimiter) {
+    auto result = std::vector<std::string>();
+    auto stream = std::istringstream(s);
+    auto item = std::string();
+    while (std::getline(stream, item, delimiter)) {
+        result.push_back(item);
+    }
+    return result;
+}
+
+static Options parse_options(const int argc, char** argv) {
+    auto options = Options();
+    for (auto i = 1; i < argc; ++i) {
+        const auto flag = std::string(argv[i]);
+        if (i + 1 == argc) {
+            raise_error("missing value for " + flag);
+        }
+        const auto value = std::string(argv[++i]);
+        if (flag == "--models") {
+            options.models = split(value, ',');
+        } else if (flag == "--sizes") {
+            options.sizes.clear();
+            for (const auto& size : split(value, ',')) {
+                options.sizes.push_back(static_cast<size_t>(std::stod(size)));
+            }
+        } else if (flag == "--timesteps") {
+            options.timesteps = std::stoul(value);
+        } else if (flag == "--seed") {
+            options.seed = std::stoull(value);
+        } else if (flag == "--out") {
+            options.out = value;
+        } else if (flag == "--baseline") {
+            options.baseline = value;
+        } else if (flag == "--threshold") {
+            options.threshold = std::stod(value);
+        } else if (flag == "--min-seconds") {
+            options.min_seconds = std::stod(value);
+        } else if (flag == "--trace") {
+            options.trace = value;
+        } else {
+            raise_error("unknown option " + flag);
+        }
+    }
+    return options;
+}
+
+//' @title build and run a model, writing its timings and the peak memory held
+//' by each variable and event to out as "metric value" lines
+static void run_model(
+    const std::string& name,
+    const size_t size,
+    const Options& options,
+    std::ostream& out
+) {
+    default_rng().seed(options.seed);
+    const auto setup_start = profile_clock_t::now();
+    auto model = create_reference_model(name, size, options.timesteps);
+    Simulation simulation;
+    Profiler profiler;
+    MemoryReport memory(10);
+    model->add_to(simulation);
+    simulation.set_profiler(profiler);
+    simulation.set_memory_report(memory);
+    const auto setup = seconds_since(setup_start);
+
+    auto recorder = std::unique_ptr<TraceRecorder>();
+    if (!options.trace.empty()) {
+        recorder.reset(new TraceRecorder());
+        trace_recorder() = recorder.get();
+    }
+    const auto run_start = profile_clock_t::now();
+    simulation.run(1, options.timesteps);
+    const auto run = seconds_since(run_start);
+    if (recorder) {
+        trace_recorder() = nullptr;
+        recorder->write(
+            options.trace + "/" + name + "_" + std::to_string(size) + ".json"
+        );
+    }
+
+    // total the time of each phase over every timestep
+    auto totals = std::map<std::string, double>();
+    const auto kinds = profiler.get_kinds();
+    const auto names = profiler.get_names();
+    const auto& seconds = profiler.get_seconds();
+    for (auto i = 0u; i < profiler.size(); ++i) {
+        totals[kinds[i] + ":" + names[i]] += seconds[i];
+    }
+
+    out << "setup_seconds " << setup << "\n";
+    out << "run_seconds " << run << "\n";
+    auto timed = 0.;
+    for (const auto& phase : totals) {
+        out << phase.first << "_seconds " << phase.second << "\n";
+        timed += phase.second;
+    }
+    // scheduling, resizing and ticking events, and the loop itself
+    out << "other_seconds " << run - timed << "\n";
+
+    // the most memory each variable and event held on a reported timestep
+    auto peaks = std::map<std::string, size_t>();
+    const auto& memory_kinds = memory.get_kinds();
+    const auto& memory_names = memory.get_names();
+    const auto& usages = memory.get_usages();
+    for (auto i = 0u; i < memory.size(); ++i) {
+        auto& peak = peaks[memory_kinds[i] + ":" + memory_names[i]];
+        peak = std::max(peak, usages[i].total());
+    }
+    for (const auto& peak : peaks) {
+        out << "memory:" << peak.first << "_mb " << peak.second / 1048576. << "\n";
+    }
+}
+
+//' @title run a model in a child process, and measure its peak memory
+static std::vector<Result> run_child(
+    const std::string& name,
+    const size_t size,
+    const Options& options
+) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        raise_error("could not create a pipe for the model");
+    }
+    std::cout.flush();
+    const auto pid = fork();
+    if (pid < 0) {
+        raise_error("could not fork to run the model");
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        auto status = 0;
+        auto out = std::ostringstream();
+        out << std::setprecision(9);
+        try {
+            run_model(name, size, options, out);
+        } catch (const std::exception& e) {
+            std::cerr << name << " " << size << ": " << e.what() << std::endl;
+            status = 1;
+        }
+        const auto text = out.str();
+        auto written = size_t(0);
+        while (written < text.size()) {
+            const auto n = write(fds[1], text.data() + written, text.size() - written);
+            if (n <= 0) {
+                status = 1;
+                break;
+            }
+            written += n;
+        }
+        close(fds[1]);
+        _exit(status);
+    }
+
+    close(fds[1]);
+    auto text = std::string();
+    char buffer[4096];
+    for (auto n = read(fds[0], buffer, sizeof(buffer)); n > 0; n = read(fds[0], buffer, sizeof(buffer))) {
+        text.append(buffer, n);
+    }
+    close(fds[0]);
+    auto status = 0;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        raise_error("the " + name + " model failed at size " + std::to_string(size));
+    }
+
+    auto results = std::vector<Result>();
+    auto lines = std::istringstream(text);
+    auto metric = std::string();
+    auto value = 0.;
+    while (lines >> metric >> value) {
+        results.push_back({name, size, metric, value});
+    }
+    // ru_maxrss is in kilobytes on Linux
+    results.push_back({name, size, "peak_rss_mb", usage.ru_maxrss / 1024.});
+    return results;
+}
+
+static void write_results(std::ostream& out, const std::vector<Result>& results) {
+    out << "model,size,metric,value\n" << std::setprecision(9);
+    for (const auto& result : results) {
+        out << result.model << "," << result.size << ","
+            << result.metric << "," << result.value << "\n";
+    }
+}
+
+static std::map<result_key_t, double> read_results(const std::string& path) {
+    auto in = std::ifstream(path);
+    if (!in) {
+        raise_error("could not read the baseline " + path);
+    }
+    auto results = std::map<result_key_t, double>();
+    auto line = std::string();
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        const auto fields = split(line, ',');
+        if (fields.size() != 4) {
+            continue;
+        }
+        results[result_key_t(fields[0], std::stoul(fields[1]), fields[2])] = std::stod(fields[3]);
+    }
+    return results;
+}
+
+//' @title report the metrics which regressed past the threshold
+//' @return the number of regressions
+static size_t compare_results(
+    const std::vector<Result>& results,
+    const std::map<result_key_t, double>& baseline,
+    const Options& options
+) {
+    auto regressions = size_t(0);
+    std::cout << "\nmodel,size,metric,baseline,value,change\n" << std::setprecision(4);
+    for (const auto& result : results) {
+        const auto it = baseline.find(result_key_t(result.model, result.size, result.metric));
+        if (it == baseline.end()) {
+            continue;
+        }
+        const auto is_time = result.metric.size() > 8 &&
+            result.metric.compare(result.metric.size() - 8, 8, "_seconds") == 0;
+        if (is_time && it->second < options.min_seconds) {
+            continue;
+        }
+        // nothing to compare against, such as an event which was never
+        // scheduled
+        if (it->second <= 0) {
+            continue;
+        }
+        const auto change = result.value / it->second - 1;
+        const auto regressed = change > options.threshold;
+        regressions += regressed;
+        std::cout << result.model << "," << result.size << "," << result.metric << ","
+                  << it->second << "," << result.value << ","
+                  << std::showpos << change * 100 << std::noshowpos << "%"
+                  << (regressed ? " REGRESSION" : "") << "\n";
+    }
+    return regressions;
+}
+
+int main(int argc, char** argv) {
+    try {
+        const auto options = parse_options(argc, argv);
+        auto results = std::vector<Result>();
+        for (const auto& size : options.sizes) {
+            for (const auto& model : options.models) {
+                const auto model_results = run_child(model, size, options);
+                results.insert(results.end(), model_results.begin(), model_results.end());
+            }
+        }
+        write_results(std::cout, results);
+        if (!options.out.empty()) {
+            auto out = std::ofstream(options.out);
+            write_results(out, results);
+        }
+        if (!options.baseline.empty()) {
+            const auto regressions = compare_results(
+                results,
+                read_results(options.baseline),
+                options
+            );
+            if (regressions > 0) {
+                std::cout << regressions << " metrics regressed by more than "
+                          << options.threshold * 100 << "%\n";
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
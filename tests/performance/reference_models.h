@@ -0,0 +1,399 @@
+/*
+ * reference_models.h
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#ifndef TESTS_PERFORMANCE_REFERENCE_MODELS_H_
+#define TESTS_PERFORMANCE_REFERENCE_MODELS_H_
+
+#include "prefab.h"
+#include "Simulation.h"
+#include "Population.h"
+#include "ResizeCoordinator.h"
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+//' @title a model to benchmark end to end
+//' @description each model owns its variables and events, and adds its
+//' processes, listeners and variables to a simulation under names which
+//' identify them in the simulation's profile.
+//' Models draw their initial state and all of their random numbers from the
+//' default stream, so they do the same work for the same seed.
+struct ReferenceModel {
+    virtual void add_to(Simulation& simulation) = 0;
+    virtual ~ReferenceModel() = default;
+};
+
+//' @title the initial health states of a population with prevalence infected
+inline std::vector<std::string> initial_health(
+    const size_t size,
+    const double prevalence
+) {
+    auto values = std::vector<std::string>(size, "S");
+    const auto random = random_uniforms(size);
+    for (auto i = 0u; i < size; ++i) {
+        if (random[i] < prevalence) {
+            values[i] = "I";
+        }
+    }
+    return values;
+}
+
+//' @title exponentially distributed delays with the given mean
+inline std::vector<double> exponential_delays(const size_t n, const double mean) {
+    auto delays = random_uniforms(n);
+    for (auto& delay : delays) {
+        delay = -std::log(delay) * mean;
+    }
+    return delays;
+}
+
+//' @title a process infecting susceptible individuals with a force of
+//' infection proportional to the prevalence among the living
+//' @param infected the state infected individuals move to
+//' @param alive the living individuals, or null if everyone is alive
+//' @param on_infection called with the newly infected, if set
+inline process_t infection_process(
+    CategoricalVariable& health,
+    const double beta,
+    const std::string infected,
+    const individual_index_t* alive = nullptr,
+    const std::function<void (const individual_index_t&)> on_infection = nullptr
+) {
+    const auto variable = &health;
+    return [variable, beta, infected, alive, on_infection](size_t) {
+        auto susceptible = variable->get_index_of("S");
+        auto infectious = variable->get_index_of("I");
+        auto n = double(variable->size());
+        if (alive != nullptr) {
+            susceptible &= *alive;
+            infectious &= *alive;
+            n = alive->size();
+        }
+        const auto foi = beta * infectious.size() / n;
+        bitset_sample_internal(susceptible, -std::expm1(-foi));
+        variable->queue_update(infected, susceptible);
+        if (on_infection) {
+            on_infection(susceptible);
+        }
+    };
+}
+
+//' @title render vectors for the count of each state on each timestep
+inline std::vector<RenderVector> state_renders(
+    const std::vector<std::string>& states,
+    const size_t timesteps
+) {
+    return std::vector<RenderVector>(
+        states.size(),
+        RenderVector(std::vector<double>(timesteps))
+    );
+}
+
+//' @title a process rendering the count of each state into renders
+inline process_t state_render_process(
+    std::vector<RenderVector>& renders,
+    const CategoricalVariable& health,
+    const std::vector<std::string>& states
+) {
+    auto vectors = std::vector<RenderVector*>();
+    for (auto& render : renders) {
+        vectors.push_back(&render);
+    }
+    return categorical_count_renderer_process(vectors, health, states);
+}
+
+//' @title an SIR model built from prefab processes
+class SIRModel : public ReferenceModel {
+    const std::vector<std::string> states = {"S", "I", "R"};
+    CategoricalVariable health;
+    std::vector<RenderVector> renders;
+
+public:
+    SIRModel(const size_t size, const size_t timesteps)
+        : health(states, initial_health(size, .001)),
+          renders(state_renders(states, timesteps)) {}
+
+    void add_to(Simulation& simulation) override {
+        simulation.add_process(
+            infection_process(health, .3, "I"),
+            false,
+            "infection"
+        );
+        simulation.add_process(
+            fixed_probability_multinomial_process(health, "I", {"R"}, .1, {1.}),
+            false,
+            "recovery"
+        );
+        simulation.add_process(
+            state_render_process(renders, health, states),
+            false,
+            "render"
+        );
+        simulation.add_variable(health, "health");
+    }
+};
+
+//' @title an SEIR model where progression and recovery are scheduled with
+//' targeted events
+class SEIRModel : public ReferenceModel {
+    const std::vector<std::string> states = {"S", "E", "I", "R"};
+    CategoricalVariable health;
+    TargetedEvent progression;
+    TargetedEvent recovery;
+    std::vector<RenderVector> renders;
+
+public:
+    SEIRModel(const size_t size, const size_t timesteps)
+        : health(states, initial_health(size, .001)),
+          progression(size),
+          recovery(size),
+          renders(state_renders(states, timesteps)) {
+        const auto infectious = health.get_index_of("I");
+        recovery.schedule(infectious, exponential_delays(infectious.size(), 10));
+    }
+
+    void add_to(Simulation& simulation) override {
+        auto progression_event = &progression;
+        auto recovery_event = &recovery;
+        auto variable = &health;
+        simulation.add_process(
+            infection_process(
+                health,
+                .3,
+                "E",
+                nullptr,
+                [progression_event](const individual_index_t& infected) {
+                    progression_event->schedule(
+                        infected,
+                        exponential_delays(infected.size(), 5)
+                    );
+                }
+            ),
+            false,
+            "infection"
+        );
+        simulation.add_process(
+            state_render_process(renders, health, states),
+            false,
+            "render"
+        );
+        simulation.add_event(
+            progression,
+            {bind_target(progression, [variable, recovery_event](size_t, const individual_index_t& target) {
+                variable->queue_update("I", target);
+                recovery_event->schedule(target, exponential_delays(target.size(), 10));
+            })},
+            "progression"
+        );
+        simulation.add_event(
+            recovery,
+            {bind_target(recovery, [variable](size_t, const individual_index_t& target) {
+                variable->queue_update("R", target);
+            })},
+            "recovery"
+        );
+        simulation.add_variable(health, "health");
+    }
+};
+
+//' @title an age structured SEIR model using the infection_age_process prefab
+class AgeModel : public ReferenceModel {
+    const std::vector<std::string> states = {"S", "E", "I", "R"};
+    static const int age_bins = 10;
+    CategoricalVariable health;
+    IntegerVariable age;
+    DoubleVariable progression_rate;
+    std::vector<double> mixing;
+    std::vector<RenderVector> renders;
+
+public:
+    AgeModel(const size_t size, const size_t timesteps)
+        : health(states, initial_health(size, .001)),
+          age(std::vector<int>(size)),
+          progression_rate(random_uniforms(size)),
+          mixing(age_bins * age_bins),
+          renders(state_renders(states, timesteps)) {
+        const auto random = random_uniforms(size);
+        auto ages = std::vector<int>(size);
+        for (auto i = 0u; i < size; ++i) {
+            ages[i] = 1 + static_cast<int>(random[i] * age_bins);
+        }
+        age.queue_update(ages, std::vector<size_t>());
+        age.update();
+        auto rates = progression_rate.get_values();
+        for (auto& rate : rates) {
+            rate *= .4;
+        }
+        progression_rate.queue_update(rates, std::vector<size_t>());
+        progression_rate.update();
+        // contacts are most frequent within an age bin
+        for (auto a = 0; a < age_bins; ++a) {
+            for (auto b = 0; b < age_bins; ++b) {
+                mixing[a + b * age_bins] = a == b ? 1. : .2;
+            }
+        }
+    }
+
+    void add_to(Simulation& simulation) override {
+        simulation.add_process(
+            infection_age_process(
+                health,
+                "S",
+                "E",
+                "I",
+                age,
+                age_bins,
+                .3,
+                1,
+                mixing.data(),
+                age_bins
+            ),
+            false,
+            "infection"
+        );
+        simulation.add_process(
+            multi_probability_bernoulli_process(health, "E", "I", progression_rate),
+            false,
+            "progression"
+        );
+        simulation.add_process(
+            fixed_probability_multinomial_process(health, "I", {"R"}, .1, {1.}),
+            false,
+            "recovery"
+        );
+        simulation.add_process(
+            state_render_process(renders, health, states),
+            false,
+            "render"
+        );
+        simulation.add_variable(health, "health");
+        simulation.add_variable(age, "age");
+        simulation.add_variable(progression_rate, "progression_rate");
+    }
+};
+
+//' @title an SIR model with births and deaths in a Population
+//' @description deaths are tombstoned, and births reuse the dead slots or
+//' extend the population. Births are slightly less frequent than deaths, so
+//' dead slots build up and the population is compacted every few dozen
+//' timesteps.
+class DemographyModel : public ReferenceModel {
+    const std::vector<std::string> states = {"S", "I", "R"};
+    CategoricalVariable health;
+    DoubleVariable birth_time;
+    Population population;
+    ResizeCoordinator coordinator;
+    std::vector<RenderVector> renders;
+
+public:
+    DemographyModel(const size_t size, const size_t timesteps)
+        : health(states, initial_health(size, .001)),
+          birth_time(std::vector<double>(size)),
+          population(size, .01),
+          coordinator(size, 1),
+          renders(state_renders(states, timesteps)) {
+        coordinator.add_variable(health);
+        coordinator.add_variable(birth_time);
+    }
+
+    void add_to(Simulation& simulation) override {
+        auto pop = &population;
+        auto variable = &health;
+        auto birth = &birth_time;
+        auto resizer = &coordinator;
+        simulation.add_process(
+            infection_process(health, .3, "I", &population.get_alive()),
+            false,
+            "infection"
+        );
+        simulation.add_process(
+            fixed_probability_multinomial_process(health, "I", {"R"}, .1, {1.}),
+            false,
+            "recovery"
+        );
+        simulation.add_process([pop](size_t) {
+            auto deaths = pop->get_alive();
+            bitset_sample_internal(deaths, .001);
+            pop->queue_shrink(deaths);
+        }, false, "deaths");
+        simulation.add_process([pop, variable, birth](size_t t) {
+            const auto n = static_cast<size_t>(pop->size() * .0008);
+            const auto capacity = pop->capacity();
+            const auto slots = pop->queue_extend(n);
+            auto reused = std::vector<size_t>();
+            for (const auto slot : slots) {
+                if (slot < capacity) {
+                    reused.push_back(slot);
+                }
+            }
+            if (!reused.empty()) {
+                variable->queue_update("S", individual_index_t(capacity, reused));
+                birth->queue_update({double(t)}, reused);
+            }
+            const auto extended = slots.size() - reused.size();
+            variable->queue_extend(std::vector<std::string>(extended, "S"));
+            birth->queue_extend(std::vector<double>(extended, t));
+        }, false, "births");
+        simulation.add_process(
+            state_render_process(renders, health, states),
+            false,
+            "render"
+        );
+        simulation.add_variable(
+            [variable, birth]() {
+                variable->update();
+                birth->update();
+            },
+            [pop, resizer]() {
+                resizer->resize();
+                pop->resize();
+                if (pop->get_free().size() > 0) {
+                    resizer->tombstone(pop->get_free());
+                }
+                if (pop->should_compact()) {
+                    resizer->queue_shrink(pop->compact());
+                    resizer->resize();
+                }
+            },
+            "population",
+            [pop, variable, birth]() {
+                auto usage = pop->memory_usage();
+                usage += variable->memory_usage();
+                usage += birth->memory_usage();
+                return usage;
+            }
+        );
+    }
+};
+
+//' @title the names of the reference models
+inline std::vector<std::string> reference_model_names() {
+    return {"sir", "seir", "age", "demography"};
+}
+
+//' @title create a reference model of size individuals, rendering timesteps
+inline std::unique_ptr<ReferenceModel> create_reference_model(
+    const std::string& name,
+    const size_t size,
+    const size_t timesteps
+) {
+    if (name == "sir") {
+        return std::unique_ptr<ReferenceModel>(new SIRModel(size, timesteps));
+    }
+    if (name == "seir") {
+        return std::unique_ptr<ReferenceModel>(new SEIRModel(size, timesteps));
+    }
+    if (name == "age") {
+        return std::unique_ptr<ReferenceModel>(new AgeModel(size, timesteps));
+    }
+    if (name == "demography") {
+        return std::unique_ptr<ReferenceModel>(new DemographyModel(size, timesteps));
+    }
+    raise_error("unknown reference model: " + name);
+}
+
+#endif /* TESTS_PERFORMANCE_REFERENCE_MODELS_H_ */
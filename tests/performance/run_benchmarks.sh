@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+# Build the C++ benchmarks in Release mode and write their results as JSON,
+# which can be diffed between releases with google benchmark's compare.py:
+#
+#   tests/performance/run_benchmarks.sh before.json
+#   git checkout <release>
+#   tests/performance/run_benchmarks.sh after.json
+#   compare.py benchmarks before.json after.json
+#
+# Any arguments after the output file are passed to the benchmark binary,
+# e.g. --benchmark_filter=Bitset
+set -euo pipefail
+
+out=${1:-benchmarks.json}
+shift || true
+build=${BUILD_DIR:-build/benchmarks}
+
+cmake -S . -B "$build" -DCMAKE_BUILD_TYPE=Release -DINDIVIDUAL_BUILD_BENCHMARKS=ON
+cmake --build "$build" -j"$(nproc)"
+"$build/tests/performance/individual_benchmarks" \
+  --benchmark_out="$out" \
+  --benchmark_out_format=json \
+  --benchmark_repetitions="${REPETITIONS:-3}" \
+  --benchmark_report_aggregates_only=true \
+  "$@"
@@ -7,9 +7,8 @@
 
 #include <benchmark/benchmark.h>
 #include <unordered_set>
-#include "../../inst/include/IterableBitset.h"
+#include "common_types.h"
 
-using individual_index_t = IterableBitset<uint64_t>;
 //using individual_index_t = std::unordered_set<size_t>;
 
 std::vector<size_t>create_random_data(size_t size, size_t limit) {
@@ -76,5 +75,3 @@ static void BM_IndexErase(benchmark::State& state) {
 
 BENCHMARK(BM_IndexErase)
     ->Ranges({{1<<10, 8<<10}, {1<<10, 8<<12}});
-
-BENCHMARK_MAIN();